@@ -13,6 +13,7 @@
 
 #include "CwAPI3DVersion.h"
 #include "CwAPI3DTypes.h"
+#include "CwAPI3DGuid.h"
 #include "ICwAPI3DControllerFactory.h"
 
 namespace CwAPI3D
@@ -144,6 +145,11 @@ namespace CwAPI3D
    */
   using ProcessType = Interfaces::ICwAPI3DProcessType;
 
+  /**
+   * @brief abstraction of current processing table helper for convenience purposes
+   */
+  using ProcessingTable = Interfaces::ICwAPI3DProcessingTable;
+
   /**
    * @brief abstraction of current string helper for convenience purposes
    */
@@ -178,6 +184,21 @@ namespace CwAPI3D
   using GridController = Interfaces::ICwAPI3DGridController;
   using RhinoOptions = Interfaces::ICwAPI3DRhinoOptions;
   using IfcOptions = Interfaces::ICwAPI3DIfcOptions;
+  using LinearOptimizationOptions = Interfaces::ICwAPI3DLinearOptimizationOptions;
+  using LinearOptimizationResult = Interfaces::ICwAPI3DLinearOptimizationResult;
+  using NestingOptions = Interfaces::ICwAPI3DNestingOptions;
+  using NestingResult = Interfaces::ICwAPI3DNestingResult;
+  using ShopDrawingBatch = Interfaces::ICwAPI3DShopDrawingBatch;
+  using HiddenLineSink = Interfaces::ICwAPI3DHiddenLineSink;
+  using MaterialTable = Interfaces::ICwAPI3DMaterialTable;
+  using MaterialUpdate = Interfaces::ICwAPI3DMaterialUpdate;
+  using EndtypeMatrix = Interfaces::ICwAPI3DEndtypeMatrix;
+  using ConnectorAxisSnapshot = Interfaces::ICwAPI3DConnectorAxisSnapshot;
+  using BuildingHierarchy = Interfaces::ICwAPI3DBuildingHierarchy;
+  using MultiLayerSetSnapshot = Interfaces::ICwAPI3DMultiLayerSetSnapshot;
+  using DimensionSnapshot = Interfaces::ICwAPI3DDimensionSnapshot;
+  using ProjectDataTable = Interfaces::ICwAPI3DProjectDataTable;
+  using ProgressToken = Interfaces::ICwAPI3DProgressToken;
 }
 
 /**
@@ -0,0 +1,244 @@
+/** @file
+* Copyright (C) 2026 cadwork informatik AG
+*
+* This file is part of the CwAPI3D module for cadwork 3d.
+*
+* @ingroup       CwAPI3D
+* @since         32.0
+* @author        Paquet
+* @date          2026-10-18
+*/
+
+#pragma once
+
+#include <stddef.h>
+
+#include "CwAPI3DTypes.h"
+
+namespace CwAPI3D
+{
+  /// @struct guid
+  /// @brief 128-bit GUID, bytes in the order of the standard text format
+  struct guid
+  {
+    /// @brief GUID bytes
+    uint8_t mBytes[16];
+  };
+
+  /// @brief Number of characters of a GUID in IFC base64 format ("28kif20KPEuBjk2m1N3ep$")
+  const uint32_t ifcGuidLength = 22;
+
+  /// @brief Number of characters of a GUID in standard format ("8852c3e4-0a3c-4d99-9bd4-d3c26c2c4b3f")
+  const uint32_t guidLength = 36;
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+  namespace detail
+  {
+    struct guidTables
+    {
+      const char* mIfcDigits;
+      int8_t mIfcValues[128];
+      int8_t mHexValues[128];
+
+      guidTables()
+        : mIfcDigits("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz_$")
+      {
+        for (int32_t i = 0; i < 128; ++i)
+        {
+          mIfcValues[i] = -1;
+          mHexValues[i] = -1;
+        }
+        for (int32_t i = 0; i < 64; ++i)
+        {
+          mIfcValues[static_cast<uint8_t>(mIfcDigits[i])] = static_cast<int8_t>(i);
+        }
+        for (int32_t i = 0; i < 10; ++i)
+        {
+          mHexValues['0' + i] = static_cast<int8_t>(i);
+        }
+        for (int32_t i = 0; i < 6; ++i)
+        {
+          mHexValues['a' + i] = static_cast<int8_t>(10 + i);
+          mHexValues['A' + i] = static_cast<int8_t>(10 + i);
+        }
+      }
+    };
+
+    inline const guidTables& getGuidTables()
+    {
+      static const guidTables tables;
+      return tables;
+    }
+
+    template<typename TChar>
+    inline int32_t lookup(const int8_t* aTable, TChar aCharacter)
+    {
+      const uint32_t code = static_cast<uint32_t>(aCharacter);
+      return code < 128 ? aTable[code] : -1;
+    }
+  }
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+  /// @brief Encodes a GUID in IFC base64 format.
+  /// @param[in] aGuid [@ref guid] The GUID.
+  /// @param[out] aText [TChar*] Receives @ref ifcGuidLength characters, not zero-terminated.
+  template<typename TChar>
+  inline void encodeIfcGuid(const guid& aGuid, TChar* aText)
+  {
+    const char* digits = detail::getGuidTables().mIfcDigits;
+    const uint8_t* bytes = aGuid.mBytes;
+    aText[0] = static_cast<TChar>(digits[bytes[0] >> 6]);
+    aText[1] = static_cast<TChar>(digits[bytes[0] & 63]);
+    for (uint32_t i = 0; i < 5; ++i)
+    {
+      const uint32_t value = (static_cast<uint32_t>(bytes[3 * i + 1]) << 16) | (static_cast<uint32_t>(bytes[3 * i + 2]) << 8) | bytes[3 * i + 3];
+      TChar* out = aText + 2 + 4 * i;
+      out[0] = static_cast<TChar>(digits[(value >> 18) & 63]);
+      out[1] = static_cast<TChar>(digits[(value >> 12) & 63]);
+      out[2] = static_cast<TChar>(digits[(value >> 6) & 63]);
+      out[3] = static_cast<TChar>(digits[value & 63]);
+    }
+  }
+
+  /// @brief Decodes a GUID in IFC base64 format.
+  /// @param[in] aText [const TChar*] @ref ifcGuidLength characters, no terminator required.
+  /// @param[out] aGuid [@ref guid] Receives the GUID, all zero if the text is invalid.
+  /// @return [bool] True if the text is a valid IFC GUID, false otherwise.
+  template<typename TChar>
+  inline bool decodeIfcGuid(const TChar* aText, guid& aGuid)
+  {
+    const int8_t* values = detail::getGuidTables().mIfcValues;
+    int32_t invalid = 0;
+    uint32_t digits[ifcGuidLength];
+    for (uint32_t i = 0; i < ifcGuidLength; ++i)
+    {
+      const int32_t value = detail::lookup(values, aText[i]);
+      invalid |= value;
+      digits[i] = static_cast<uint32_t>(value) & 63;
+    }
+    invalid |= 3 - static_cast<int32_t>(digits[0]);
+    if (invalid < 0)
+    {
+      aGuid = guid{};
+      return false;
+    }
+
+    aGuid.mBytes[0] = static_cast<uint8_t>((digits[0] << 6) | digits[1]);
+    for (uint32_t i = 0; i < 5; ++i)
+    {
+      const uint32_t* in = digits + 2 + 4 * i;
+      const uint32_t value = (in[0] << 18) | (in[1] << 12) | (in[2] << 6) | in[3];
+      aGuid.mBytes[3 * i + 1] = static_cast<uint8_t>(value >> 16);
+      aGuid.mBytes[3 * i + 2] = static_cast<uint8_t>(value >> 8);
+      aGuid.mBytes[3 * i + 3] = static_cast<uint8_t>(value);
+    }
+    return true;
+  }
+
+  /// @brief Formats a GUID in lower case standard format.
+  /// @param[in] aGuid [@ref guid] The GUID.
+  /// @param[out] aText [TChar*] Receives @ref guidLength characters, not zero-terminated.
+  template<typename TChar>
+  inline void formatGuid(const guid& aGuid, TChar* aText)
+  {
+    const char hexDigits[] = "0123456789abcdef";
+    TChar* out = aText;
+    for (uint32_t i = 0; i < 16; ++i)
+    {
+      if (i == 4 || i == 6 || i == 8 || i == 10)
+      {
+        *out++ = static_cast<TChar>('-');
+      }
+      *out++ = static_cast<TChar>(hexDigits[aGuid.mBytes[i] >> 4]);
+      *out++ = static_cast<TChar>(hexDigits[aGuid.mBytes[i] & 15]);
+    }
+  }
+
+  /// @brief Parses a GUID in standard format, upper or lower case, without braces.
+  /// @param[in] aText [const TChar*] @ref guidLength characters, no terminator required.
+  /// @param[out] aGuid [@ref guid] Receives the GUID, all zero if the text is invalid.
+  /// @return [bool] True if the text is a valid GUID, false otherwise.
+  template<typename TChar>
+  inline bool parseGuid(const TChar* aText, guid& aGuid)
+  {
+    const int8_t* values = detail::getGuidTables().mHexValues;
+    int32_t invalid = 0;
+    const TChar* in = aText;
+    for (uint32_t i = 0; i < 16; ++i)
+    {
+      if (i == 4 || i == 6 || i == 8 || i == 10)
+      {
+        invalid |= *in++ == static_cast<TChar>('-') ? 0 : -1;
+      }
+      const int32_t high = detail::lookup(values, in[0]);
+      const int32_t low = detail::lookup(values, in[1]);
+      invalid |= high | low;
+      aGuid.mBytes[i] = static_cast<uint8_t>(((high & 15) << 4) | (low & 15));
+      in += 2;
+    }
+    if (invalid < 0)
+    {
+      aGuid = guid{};
+      return false;
+    }
+    return true;
+  }
+
+  /// @brief Encodes many GUIDs in IFC base64 format.
+  /// @param[in] aGuids [const @ref guid*] The GUIDs.
+  /// @param[in] aCount [uint32_t] The number of GUIDs.
+  /// @param[out] aText [TChar*] Receives aCount * @ref ifcGuidLength characters, without separators.
+  template<typename TChar>
+  inline void encodeIfcGuids(const guid* aGuids, uint32_t aCount, TChar* aText)
+  {
+    for (uint32_t i = 0; i < aCount; ++i)
+    {
+      encodeIfcGuid(aGuids[i], aText + static_cast<size_t>(i) * ifcGuidLength);
+    }
+  }
+
+  /// @brief Decodes many GUIDs in IFC base64 format.
+  /// @param[in] aText [const TChar*] aCount * @ref ifcGuidLength characters, without separators.
+  /// @param[in] aCount [uint32_t] The number of GUIDs.
+  /// @param[out] aGuids [@ref guid*] Receives the GUIDs, all zero for invalid entries.
+  /// @return [uint32_t] The number of invalid entries.
+  template<typename TChar>
+  inline uint32_t decodeIfcGuids(const TChar* aText, uint32_t aCount, guid* aGuids)
+  {
+    uint32_t invalidCount = 0;
+    for (uint32_t i = 0; i < aCount; ++i)
+    {
+      invalidCount += decodeIfcGuid(aText + static_cast<size_t>(i) * ifcGuidLength, aGuids[i]) ? 0 : 1;
+    }
+    return invalidCount;
+  }
+
+  /// @brief Formats many GUIDs in standard format.
+  /// @param[in] aGuids [const @ref guid*] The GUIDs.
+  /// @param[in] aCount [uint32_t] The number of GUIDs.
+  /// @param[out] aText [TChar*] Receives aCount * @ref guidLength characters, without separators.
+  template<typename TChar>
+  inline void formatGuids(const guid* aGuids, uint32_t aCount, TChar* aText)
+  {
+    for (uint32_t i = 0; i < aCount; ++i)
+    {
+      formatGuid(aGuids[i], aText + static_cast<size_t>(i) * guidLength);
+    }
+  }
+
+  /// @brief Parses many GUIDs in standard format.
+  /// @param[in] aText [const TChar*] aCount * @ref guidLength characters, without separators.
+  /// @param[in] aCount [uint32_t] The number of GUIDs.
+  /// @param[out] aGuids [@ref guid*] Receives the GUIDs, all zero for invalid entries.
+  /// @return [uint32_t] The number of invalid entries.
+  template<typename TChar>
+  inline uint32_t parseGuids(const TChar* aText, uint32_t aCount, guid* aGuids)
+  {
+    uint32_t invalidCount = 0;
+    for (uint32_t i = 0; i < aCount; ++i)
+    {
+      invalidCount += parseGuid(aText + static_cast<size_t>(i) * guidLength, aGuids[i]) ? 0 : 1;
+    }
+    return invalidCount;
+  }
+}
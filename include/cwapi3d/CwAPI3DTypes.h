@@ -372,6 +372,271 @@ namespace CwAPI3D
     AutoCadR27
   };
 
+  /// @enum ListExportFormat
+  /// @brief File formats of the streaming list exports
+  /// @details Layout of the @ref ListExportFormat::Columnar format, version 1.
+  /// All integers are little-endian, there is no padding or alignment between fields.
+  /// - Header:
+  ///   - magic: 4 bytes "CWLC"
+  ///   - version: uint16, 1
+  ///   - reserved: uint16, 0
+  ///   - columnCount: uint32
+  /// - Column table, columnCount entries in column order:
+  ///   - type: uint8, 0 = Float64 (IEEE 754 double), 1 = Int64 (two's complement), 2 = String (UTF-8)
+  ///   - nameLength: uint32, number of bytes of the name
+  ///   - name: nameLength bytes of UTF-8, not zero-terminated
+  /// - Blocks, in list order, until the end block:
+  ///   - rowCount: uint32, 1 to 65536 rows, 0 for the end block which has no further fields
+  ///   - blockSize: uint64, number of bytes of the column data that follows, so a reader can skip the block
+  ///   - column data, for each column in column order:
+  ///     - nulls: (rowCount + 7) / 8 bytes, bit (i % 8) of byte i / 8 set if row i is null
+  ///     - Float64 / Int64 columns: rowCount values of 8 bytes, 0 for null rows
+  ///     - String columns: rowCount + 1 uint32 offsets, starting at 0, followed by offsets[rowCount] bytes of UTF-8;
+  ///       row i is the bytes [offsets[i], offsets[i + 1]), empty for null rows
+  ///
+  /// A file without end block was not completely written. Readers must reject versions they do not know.
+  enum class ListExportFormat : int32_t
+  {
+    Csv = 0,  ///< UTF-8 comma separated values, one row per list position.
+    Columnar, ///< Binary column blocks with typed columns, see the layout above.
+  };
+
+  /// @enum ShopDrawingExportType
+  /// @brief Kinds of shop drawing exports
+  enum class ShopDrawingExportType : int32_t
+  {
+    Wall = 0,     ///< Wall export, like ICwAPI3DShopDrawingController::exportWallWithClipboard.
+    ExportSolid,  ///< Export solid, like ICwAPI3DShopDrawingController::exportExportSolidWithClipboard.
+    PieceByPiece, ///< Piece by piece export, like ICwAPI3DShopDrawingController::exportPieceByPieceWithClipboard.
+    Container,    ///< Container export, like ICwAPI3DShopDrawingController::exportContainerWithClipboard.
+  };
+
+  /// @enum HiddenLineSegmentType
+  /// @brief Visibility of a segment produced by the hidden line removal
+  enum class HiddenLineSegmentType : int32_t
+  {
+    Visible = 0, ///< Segment is visible, drawn solid.
+    Hidden,      ///< Segment is covered by other geometry, drawn dashed.
+  };
+
+  namespace elementStateFlag
+  {
+    /// @enum elementStateFlag
+    /// @brief Bits of the per-element state byte returned by ICwAPI3DVisualizationController::getElementStateFlags
+    enum elementStateFlag : uint8_t
+    {
+      Visible = 1 << 0,
+      Active = 1 << 1,
+      Selectable = 1 << 2,
+      Immutable = 1 << 3,
+      TextureRotated = 1 << 4,
+    };
+  }
+
+  /// @enum MaterialProperty
+  /// @brief Material properties of the material table and bulk material updates
+  enum class MaterialProperty : int32_t
+  {
+    Name = 0,               ///< Text.
+    Group,                  ///< Text.
+    Code,                   ///< Text.
+    ModulusElasticity1,     ///< Number.
+    ModulusElasticity2,     ///< Number.
+    ModulusElasticity3,     ///< Number.
+    ShearModulus1,          ///< Number.
+    ShearModulus2,          ///< Number.
+    Price,                  ///< Number.
+    PriceType,              ///< Text.
+    ThermalConductivity,    ///< Number.
+    HeatCapacity,           ///< Number.
+    UMin,                   ///< Number.
+    UMax,                   ///< Number.
+    FireResistanceClass,    ///< Text.
+    SmokeClass,             ///< Text.
+    DropFormingClass,       ///< Text.
+    BurnOffRate,            ///< Number.
+    Weight,                 ///< Number.
+    WeightType,             ///< Text.
+    Grade,                  ///< Text.
+    Quality,                ///< Text.
+    Composition,            ///< Text.
+    ShortName,              ///< Text, read-only.
+    TextureColor,           ///< Number.
+    TextureTransparency,    ///< Number.
+    TextureRotationAngle,   ///< Number.
+    TextureLengthAlignment, ///< Number, 0 or 1.
+    TextureZoomX,           ///< Number.
+    TextureZoomY,           ///< Number.
+  };
+
+  namespace endtypeSlot
+  {
+    /// @enum endtypeSlot
+    /// @brief Columns of the endtype matrix returned by ICwAPI3DEndtypeController::getEndtypeMatrix
+    enum endtypeSlot : uint32_t
+    {
+      Start = 0,
+      End = 1,
+      Face0 = 2,
+      Face1 = 3,
+      Face2 = 4,
+      Face3 = 5,
+      Face4 = 6,
+      Face5 = 7,
+      Count = 8,
+    };
+  }
+
+  /// @struct connectorAxisSection
+  /// @brief Section of a connector axis, as returned by ICwAPI3DConnectorAxisController::getConnectorAxisSnapshot
+  struct connectorAxisSection
+  {
+    /// @brief Drilling diameter
+    double mDiameter;
+    /// @brief Section length
+    double mLength;
+    /// @brief Element the section is in contact with, 0 if none
+    elementID mContactElement;
+    /// @brief Counterbore diameter at the start side
+    double mCounterboreStartDiameter;
+    /// @brief Counterbore depth at the start side
+    double mCounterboreStartDepth;
+    /// @brief Counterbore diameter at the end side
+    double mCounterboreEndDiameter;
+    /// @brief Counterbore depth at the end side
+    double mCounterboreEndDepth;
+    /// @brief Oblong drilling positive value
+    double mOblongPositiveValue;
+    /// @brief Oblong drilling negative value
+    double mOblongNegativeValue;
+    /// @brief Oblong drilling angle
+    double mOblongAngle;
+    /// @brief Whether the start side counterbore is conical
+    bool mCounterboreStartIsConical;
+    /// @brief Whether the end side counterbore is conical
+    bool mCounterboreEndIsConical;
+    /// @brief Whether the oblong drilling is enabled
+    bool mOblongIsEnabled;
+  };
+
+  /// @struct multiLayerSet
+  /// @brief Multi layer set, as returned by ICwAPI3DMultiLayerCoverController::getMultiLayerSetSnapshot and used by createMultiLayerWallWithLayers
+  struct multiLayerSet
+  {
+    /// @brief Multi layer set id
+    multiLayerSetID mId;
+    /// @brief Cover material
+    materialID mCoverMaterial;
+    /// @brief Cover thickness
+    double mCoverThickness;
+    /// @brief Cover color
+    colorID mCoverColor;
+    /// @brief Component type
+    multiLayerComponentType::multiLayerComponentType mComponentType;
+    /// @brief Offset of the set name in the text arena
+    uint32_t mName;
+    /// @brief Offset of the cover name in the text arena
+    uint32_t mCoverName;
+    /// @brief Index of the first layer of the set
+    uint32_t mFirstLayer;
+    /// @brief Number of layers of the set
+    uint32_t mLayerCount;
+  };
+
+  /// @struct multiLayerLayer
+  /// @brief Layer of a multi layer set. Strings are referenced by their offset in a text arena.
+  struct multiLayerLayer
+  {
+    /// @brief Layer material, 0 for layers made of standard elements
+    materialID mMaterial;
+    /// @brief Layer thickness
+    double mThickness;
+    /// @brief Layer type
+    multiLayerType mType;
+    /// @brief Layer sub type
+    multiLayerSubType::multiLayerSubType mSubType;
+    /// @brief Offset of the layer name in the text arena
+    uint32_t mName;
+    /// @brief Offset of the standard panel guid in the text arena, pointing to an empty string if there is none
+    uint32_t mStandardPanelGuid;
+    /// @brief Offset of the standard beam guid in the text arena, pointing to an empty string if there is none
+    uint32_t mStandardBeamGuid;
+  };
+
+  /// @struct dimensionStyle
+  /// @brief Display settings of a dimension, as used by ICwAPI3DDimensionController::createDimensions
+  struct dimensionStyle
+  {
+    /// @brief Text size
+    double mTextSize;
+    /// @brief Line thickness
+    double mLineThickness;
+    /// @brief Default anchor length
+    double mDefaultAnchorLength;
+    /// @brief Precision / decimal places
+    uint32_t mPrecision;
+    /// @brief Text color
+    colorID mTextColor;
+    /// @brief Line color
+    colorID mLineColor;
+    /// @brief Whether the total dimension is shown
+    bool mTotalDimension;
+    /// @brief Whether distance and texts are shifted
+    bool mShiftDistanceAndTexts;
+  };
+
+  /// @struct dimensionDefinition
+  /// @brief Definition of a dimension, as used by ICwAPI3DDimensionController::createDimensions
+  struct dimensionDefinition
+  {
+    /// @brief Direction of the dimension line
+    vector3D mXl;
+    /// @brief Normal of the dimension plane
+    vector3D mPlaneNormal;
+    /// @brief Offset from the dimensioned geometry to the dimension line
+    vector3D mDistance;
+    /// @brief Index of the first point in the point array
+    uint32_t mFirstPoint;
+    /// @brief Number of points
+    uint32_t mPointCount;
+    /// @brief Index in the style array, -1 for the default style
+    int32_t mStyle;
+  };
+
+  namespace roofEdgeType
+  {
+    /// @enum roofEdgeType
+    /// @brief Roof edge types, columns of the matrix returned by ICwAPI3DRoofController::getRoofLengths
+    enum roofEdgeType : uint32_t
+    {
+      None = 0,                          ///< "none"
+      Ridge = 1,                         ///< "ridge"
+      Eave = 2,                          ///< "eave"
+      VergeRight = 3,                    ///< "vergeright"
+      VergeLeft = 4,                     ///< "vergeleft"
+      VergeOblique = 5,                  ///< "vergeoblique"
+      Hip = 6,                           ///< "hip"
+      Valley = 7,                        ///< "valley"
+      UserDefined1 = 8,                  ///< "userdefined1"
+      UserDefined2 = 9,                  ///< "userdefined2"
+      UserDefinedMitreJoint1 = 10,       ///< "userdefinedmitrejoint1"
+      UserDefinedMitreJoint2 = 11,       ///< "userdefinedmitrejoint2"
+      WallConnection = 12,               ///< "wallconnection"
+      WallConnectionRight = 13,          ///< "wallconnectionright"
+      WallConnectionLeft = 14,           ///< "wallconnectionleft"
+      WallConnectionTop = 15,            ///< "wallconnectiontop"
+      WallConnectionBottom = 16,         ///< "wallconnectionbottom"
+      RoofCutout = 17,                   ///< "roofcutout"
+      RoofCutoutRight = 18,              ///< "roofcutoutright"
+      RoofCutoutLeft = 19,               ///< "roofcutoutleft"
+      RoofCutoutTop = 20,                ///< "roofcutouttop"
+      RoofCutoutBottom = 21,             ///< "roofcutoutbottom"
+      RoofEdgeOnTopRoofSurface = 22,     ///< "roofedgeontoproofsurface"
+      RoofEdgeOnBottomRoofSurface = 23,  ///< "roofedgeonbottomroofsurface"
+      Count = 24,
+    };
+  }
+
   /// @enum vbaCatalogItemType
   /// @brief Types of the elements in the VBA Catalog
   enum class vbaCatalogItemType : uint64_t
@@ -12,13 +12,14 @@
 #pragma once
 
 #include "CwAPI3DTypes.h"
+#include "ICwAPI3DElementIDList.h"
 namespace CwAPI3D
 {
   namespace Interfaces
   {
     /**
     * @interface ICwAPI3DActivationState
-    * \brief
+    * \brief Saved activation of all elements, stored as a bitmap over the element index
     */
     class ICwAPI3DActivationState
     {
@@ -27,6 +28,58 @@ namespace CwAPI3D
        * \brief Destroys itself
        */
       virtual void destroy() = 0;
+      /**
+       * \brief Returns the number of active elements
+       * \return number of active elements
+       */
+      virtual uint32_t count() = 0;
+      /**
+       * \brief Queries whether an element is active in this state
+       * \param aElementID element to query
+       * \return true if the element is active, false otherwise
+       */
+      virtual bool contains(elementID aElementID) = 0;
+      /**
+       * \brief Gets the active elements
+       * \return list of active elements
+       */
+      virtual ICwAPI3DElementIDList* getElementIDs() = 0;
+      /**
+       * \brief Marks elements as active
+       * \param aElementIDs elements to add
+       */
+      virtual void addElements(ICwAPI3DElementIDList* aElementIDs) = 0;
+      /**
+       * \brief Marks elements as not active
+       * \param aElementIDs elements to remove
+       */
+      virtual void removeElements(ICwAPI3DElementIDList* aElementIDs) = 0;
+      /**
+       * \brief Adds all active elements of another state (union)
+       * \param aOther other state
+       */
+      virtual void unite(ICwAPI3DActivationState* aOther) = 0;
+      /**
+       * \brief Keeps only elements that are also active in another state (intersection)
+       * \param aOther other state
+       */
+      virtual void intersect(ICwAPI3DActivationState* aOther) = 0;
+      /**
+       * \brief Removes all active elements of another state (difference)
+       * \param aOther other state
+       */
+      virtual void subtract(ICwAPI3DActivationState* aOther) = 0;
+      /**
+       * \brief Queries whether two states contain the same elements
+       * \param aOther other state
+       * \return true if both states are equal, false otherwise
+       */
+      virtual bool equals(ICwAPI3DActivationState* aOther) = 0;
+      /**
+       * \brief Creates a copy of this state
+       * \return copy, to be destroyed by the caller
+       */
+      virtual ICwAPI3DActivationState* clone() = 0;
     };
   }
 }
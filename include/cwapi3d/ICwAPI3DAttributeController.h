@@ -121,6 +121,7 @@ namespace CwAPI3D
       /// @param[in] aElementId [@ref elementID] The element id.
       /// @param[in] aDataID [const @ref character*] The data id to retrieve.
       /// @return [@ref ICwAPI3DString*] The element additional data
+      /// @note Use @ref getAdditionalBinaryData for binary data.
       virtual ICwAPI3DString* getAdditionalData(elementID aElementId, const character* aDataID) = 0;
 
       /// @brief Sets the element additional data.
@@ -895,6 +896,36 @@ namespace CwAPI3D
       /// @param[in] aName [const @ref character*] Name of the machine calculation set.
       /// @return [bool] True if the machine calculation set was successfully set, false otherwise.
       virtual bool setMachineCalculationSet(ICwAPI3DElementIDList* aElementIdList, const character* aName) = 0;
+
+      /// @brief Gets the binary additional data of many elements directly into a caller buffer.
+      /// @details Binary additional data is stored out-of-line, apart from the attributes and the text additional data,
+      /// so it is only loaded by the binary data functions. Data IDs are independent of the text additional data.
+      /// @param[in] aElementIdList [@ref ICwAPI3DElementIDList*] The element id list.
+      /// @param[in] aDataID [const @ref character*] The data ID.
+      /// @param[out] aBuffer [uint8_t*] Receives the data of all elements one after the other, if the total size fits. May be nullptr.
+      /// @param[in] aBufferSize [uint64_t] The buffer size in bytes.
+      /// @param[out] aOffsets [uint64_t*] Receives count + 1 offsets into aBuffer, the data of element i is [aOffsets[i], aOffsets[i + 1]). Elements without data get an empty range.
+      /// @return [uint64_t] The total data size in bytes.
+      /// @par Example:
+      /// @code{.cpp}
+      /// std::vector<uint64_t> offsets(elements->count() + 1);
+      /// uint64_t size = aFactory.getAttributeController()->getAdditionalBinaryData(elements, L"loadCases", nullptr, 0, offsets.data());
+      /// std::vector<uint8_t> data(size);
+      /// aFactory.getAttributeController()->getAdditionalBinaryData(elements, L"loadCases", data.data(), size, offsets.data());
+      /// @endcode
+      virtual uint64_t getAdditionalBinaryData(ICwAPI3DElementIDList* aElementIdList, const character* aDataID, uint8_t* aBuffer, uint64_t aBufferSize, uint64_t* aOffsets) = 0;
+
+      /// @brief Sets the binary additional data of many elements in one call.
+      /// @param[in] aElementIdList [@ref ICwAPI3DElementIDList*] The element id list.
+      /// @param[in] aDataID [const @ref character*] The data ID.
+      /// @param[in] aDataArena [const uint8_t*] Byte arena holding the data of all elements.
+      /// @param[in] aDataOffsets [const uint64_t*] count + 1 offsets into aDataArena, the data of element i is [aDataOffsets[i], aDataOffsets[i + 1]).
+      virtual void setAdditionalBinaryData(ICwAPI3DElementIDList* aElementIdList, const character* aDataID, const uint8_t* aDataArena, const uint64_t* aDataOffsets) = 0;
+
+      /// @brief Deletes the binary additional data.
+      /// @param[in] aElementIdList [@ref ICwAPI3DElementIDList*] The element id list.
+      /// @param[in] aDataID [const @ref character*] The data ID.
+      virtual void deleteAdditionalBinaryData(ICwAPI3DElementIDList* aElementIdList, const character* aDataID) = 0;
     };
   }
 }
@@ -10,10 +10,12 @@
 
 #pragma once
 
+#include "ICwAPI3DBuildingHierarchy.h"
 #include "ICwAPI3DElementIDList.h"
 #include "ICwAPI3DIfc2x3ElementType.h"
 #include "ICwAPI3DIfcOptions.h"
 #include "ICwAPI3DIfcPredefinedType.h"
+#include "ICwAPI3DProgressToken.h"
 #include "ICwAPI3DString.h"
 #include "ICwAPI3DStringList.h"
 
@@ -224,6 +226,7 @@ namespace CwAPI3D
       virtual bool exportIfc2x3SilentlyWithOptions(ICwAPI3DElementIDList* aElementIdList, const character* aFilePath, ICwAPI3DIfcOptions* aOptions) = 0;
 
       /// @brief Get elementID from an IFC base64 Guid.
+      /// @note Use @ref getElementIdsFromIfcBase64Guids to resolve many GUIDs.
       /// @param[in] aGuid [const @ref character*] An IFC GUID in base64 string format ("28kif20KPEuBjk2m1N3ep$").
       /// @return The element id.
       virtual elementID getElementIdFromIfcBase64Guid(const character* aGuid) = 0;
@@ -273,6 +276,84 @@ namespace CwAPI3D
       /// @param[in] aFilePath [const @ref character*] The path where the IFC file will be exported.
       /// @return [bool] True if the export was successful, false otherwise.
       virtual bool exportIfc4(ICwAPI3DElementIDList* aElementIdList, const character* aFilePath) = 0;
+
+      /// @brief Gets the element ids of many IFC base64 Guids in one call, using a hash index.
+      /// @param[in] aGuids [@ref ICwAPI3DStringList*] IFC GUIDs in base64 string format ("28kif20KPEuBjk2m1N3ep$").
+      /// @return [@ref ICwAPI3DElementIDList*] One element id per GUID, in the same order, 0 for GUIDs that match no element.
+      /// @par Example:
+      /// @code{.cpp}
+      /// ICwAPI3DStringList* guids = aFactory.createEmptyStringList();
+      /// guids->append(L"28kif20KPEuBjk2m1N3ep$");
+      /// guids->append(L"0M6o7Znnv7hxsbWgeu7oQq");
+      ///
+      /// ICwAPI3DElementIDList* elements = aFactory.getBimController()->getElementIdsFromIfcBase64Guids(guids);
+      /// @endcode
+      virtual ICwAPI3DElementIDList* getElementIdsFromIfcBase64Guids(ICwAPI3DStringList* aGuids) = 0;
+
+      /// @brief Gets the IFC base64 Guids of many elements in one call.
+      /// @param[in] aElementIdList [@ref ICwAPI3DElementIDList*] The element id list.
+      /// @return [@ref ICwAPI3DStringList*] One IFC GUID in base64 string format per element, in the same order.
+      virtual ICwAPI3DStringList* getIfcBase64Guids(ICwAPI3DElementIDList* aElementIdList) = 0;
+
+      /// @brief Gets all elements assigned to a storey, from the building / storey index.
+      /// @param[in] aBuilding [const @ref character*] The name of the building.
+      /// @param[in] aStorey [const @ref character*] The name of the storey, an empty string for the elements of the building without storey.
+      /// @return [@ref ICwAPI3DElementIDList*] The elements of the storey.
+      /// @par Example:
+      /// @code{.cpp}
+      /// ICwAPI3DElementIDList* groundFloor = aFactory.getBimController()->getElementsInStorey(L"Building A", L"Ground Floor");
+      /// @endcode
+      virtual ICwAPI3DElementIDList* getElementsInStorey(const character* aBuilding, const character* aStorey) = 0;
+
+      /// @brief Gets all elements assigned to a building, from the building / storey index.
+      /// @param[in] aBuilding [const @ref character*] The name of the building.
+      /// @return [@ref ICwAPI3DElementIDList*] The elements of all storeys of the building, including the elements of the building without storey.
+      virtual ICwAPI3DElementIDList* getElementsInBuilding(const character* aBuilding) = 0;
+
+      /// @brief Gets all buildings, their storeys with heights and the elements of each storey in one call.
+      /// @details Elements without storey or without building are grouped in unnamed storeys and buildings, see @ref ICwAPI3DBuildingHierarchy.
+      /// @return [@ref ICwAPI3DBuildingHierarchy*] The project hierarchy.
+      /// @par Example:
+      /// @code{.cpp}
+      /// ICwAPI3DBuildingHierarchy* hierarchy = aFactory.getBimController()->getBuildingHierarchy();
+      /// for (uint32_t b = 0; b < hierarchy->buildingCount(); ++b)
+      /// {
+      ///     for (uint32_t s = hierarchy->storeyOffsets()[b]; s < hierarchy->storeyOffsets()[b + 1]; ++s)
+      ///     {
+      ///         const uint32_t count = hierarchy->elementOffsets()[s + 1] - hierarchy->elementOffsets()[s];
+      ///         wprintf(L"%ls / %ls: %u elements\n", hierarchy->buildingName(b), hierarchy->storeyName(s), count);
+      ///     }
+      /// }
+      /// hierarchy->destroy();
+      /// @endcode
+      virtual ICwAPI3DBuildingHierarchy* getBuildingHierarchy() = 0;
+
+      /// @brief Exports an IFC 4 file silently with options, reporting progress and stopping when the token is cancelled.
+      /// @param[in] aElementIdList [@ref ICwAPI3DElementIDList*] A list of element ids to be included in the export.
+      /// @param[in] aFilePath [const @ref character*] The path where the IFC file will be exported.
+      /// @param[in] aOptions [@ref ICwAPI3DIfcOptions*] The options for the IFC export.
+      /// @param[in] aToken [@ref ICwAPI3DProgressToken*] The progress token.
+      /// @return [bool] True if the export was successful, false if it failed or was cancelled. No file is written if it was cancelled.
+      /// @par Example:
+      /// @code{.cpp}
+      /// ICwAPI3DProgressToken* token = aFactory.createProgressToken();
+      /// token->setTimeBudget(600000);
+      /// bool exported = aFactory.getBimController()->exportIfc4SilentlyWithProgress(elements, L"C:/export/model.ifc", options, token);
+      /// if (!exported && token->isCancelled())
+      /// {
+      ///     printf("IFC export cancelled after %u ms\n", token->elapsedTime());
+      /// }
+      /// token->destroy();
+      /// @endcode
+      virtual bool exportIfc4SilentlyWithProgress(ICwAPI3DElementIDList* aElementIdList, const character* aFilePath, ICwAPI3DIfcOptions* aOptions, ICwAPI3DProgressToken* aToken) = 0;
+
+      /// @brief Exports an IFC 2x3 file silently with options, reporting progress and stopping when the token is cancelled.
+      /// @param[in] aElementIdList [@ref ICwAPI3DElementIDList*] A list of element ids to be included in the export.
+      /// @param[in] aFilePath [const @ref character*] The path where the IFC file will be exported.
+      /// @param[in] aOptions [@ref ICwAPI3DIfcOptions*] The options for the IFC export.
+      /// @param[in] aToken [@ref ICwAPI3DProgressToken*] The progress token.
+      /// @return [bool] True if the export was successful, false if it failed or was cancelled. No file is written if it was cancelled.
+      virtual bool exportIfc2x3SilentlyWithProgress(ICwAPI3DElementIDList* aElementIdList, const character* aFilePath, ICwAPI3DIfcOptions* aOptions, ICwAPI3DProgressToken* aToken) = 0;
     };
   }
 }
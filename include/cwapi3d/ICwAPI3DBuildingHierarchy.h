@@ -0,0 +1,82 @@
+/** @file
+* Copyright (C) 2026 cadwork informatik AG
+*
+* This file is part of the CwAPI3D module for cadwork 3d.
+*
+* @ingroup       CwAPI3D
+* @since         32.0
+* @author        Paquet
+* @date          2026-10-18
+*/
+
+#pragma once
+
+#include "CwAPI3DTypes.h"
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    /**
+    * @interface ICwAPI3DBuildingHierarchy
+    * \brief Column-wise building / storey / element hierarchy of the project.
+    * Storeys of building b are [storeyOffsets()[b], storeyOffsets()[b + 1]), elements of storey s are
+    * elementIDs()[elementOffsets()[s]] to elementIDs()[elementOffsets()[s + 1] - 1].
+    * Elements with a building but no storey form an unnamed storey (empty name, height 0) listed last in their building,
+    * elements with a storey but no building form an unnamed building (empty name) listed last.
+    * Only elements with neither building nor storey are not part of the hierarchy.
+    * All returned pointers stay valid until the hierarchy is destroyed.
+    */
+    class ICwAPI3DBuildingHierarchy
+    {
+    public:
+      virtual ~ICwAPI3DBuildingHierarchy() noexcept = default;
+
+      /**
+       * \brief Destroys itself
+       */
+      virtual void destroy() = 0;
+
+      /**
+       * \brief Returns the number of buildings
+       */
+      virtual uint32_t buildingCount() = 0;
+      /**
+       * \brief Gets the name of a building
+       * \param aBuilding building index
+       */
+      virtual const character* buildingName(uint32_t aBuilding) = 0;
+      /**
+       * \brief Returns buildingCount() + 1 offsets into the storeys
+       */
+      virtual const uint32_t* storeyOffsets() = 0;
+
+      /**
+       * \brief Returns the total number of storeys
+       */
+      virtual uint32_t storeyCount() = 0;
+      /**
+       * \brief Gets the name of a storey
+       * \param aStorey storey index
+       */
+      virtual const character* storeyName(uint32_t aStorey) = 0;
+      /**
+       * \brief Returns storeyCount() storey heights
+       */
+      virtual const double* storeyHeights() = 0;
+      /**
+       * \brief Returns storeyCount() + 1 offsets into elementIDs()
+       */
+      virtual const uint32_t* elementOffsets() = 0;
+
+      /**
+       * \brief Returns the total number of elements assigned to a building or a storey
+       */
+      virtual uint32_t elementCount() = 0;
+      /**
+       * \brief Returns elementCount() element IDs, grouped by storey
+       */
+      virtual const elementID* elementIDs() = 0;
+    };
+  }
+}
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include "ICwAPI3DConnectorAxisSnapshot.h"
+#include "ICwAPI3DElementIDList.h"
 #include "ICwAPI3DStringList.h"
 #include "ICwAPI3DString.h"
 
@@ -300,6 +302,24 @@ namespace CwAPI3D
       /// @param[in] aNegativeValue [double] The negative value.
       /// @param[in] aAngle [double] The drilling angle.
       virtual void setSectionOblongDrillingIsEnabled(elementID aAxisId, int32_t aSectionIndex, double aPositiveValue, double aNegativeValue, double aAngle) = 0;
+
+      /// @brief Gets the sections, intersections and items of many axes in one call.
+      /// @param aAxisIdList [@ref ICwAPI3DElementIDList*] The axis id list.
+      /// @return [@ref ICwAPI3DConnectorAxisSnapshot*] The snapshot, with a deduplicated item catalogue.
+      /// @par Example:
+      /// @code{.cpp}
+      /// ICwAPI3DConnectorAxisSnapshot* snapshot = aFactory.getConnectorAxisController()->getConnectorAxisSnapshot(axes);
+      /// const connectorAxisSection* sections = snapshot->sections();
+      /// for (uint32_t i = 0; i < snapshot->axisCount(); ++i)
+      /// {
+      ///     for (uint32_t s = snapshot->sectionOffsets()[i]; s < snapshot->sectionOffsets()[i + 1]; ++s)
+      ///     {
+      ///         printf("Axis %llu: d=%f l=%f %ls\n", snapshot->axisIDs()[i], sections[s].mDiameter, sections[s].mLength, snapshot->sectionMaterialName(s));
+      ///     }
+      /// }
+      /// snapshot->destroy();
+      /// @endcode
+      virtual ICwAPI3DConnectorAxisSnapshot* getConnectorAxisSnapshot(ICwAPI3DElementIDList* aAxisIdList) = 0;
     };
   }
 }
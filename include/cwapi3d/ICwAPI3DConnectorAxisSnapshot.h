@@ -0,0 +1,135 @@
+/** @file
+* Copyright (C) 2026 cadwork informatik AG
+*
+* This file is part of the CwAPI3D module for cadwork 3d.
+*
+* @ingroup       CwAPI3D
+* @since         32.0
+* @author        Paquet
+* @date          2026-10-18
+*/
+
+#pragma once
+
+#include "CwAPI3DTypes.h"
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    /**
+    * @interface ICwAPI3DConnectorAxisSnapshot
+    * \brief Flat snapshot of connector axes with their sections and intersections.
+    * Sections of axis i are [sectionOffsets()[i], sectionOffsets()[i + 1]), intersections likewise with intersectionOffsets(),
+    * and the items of intersection j are [intersectionItemOffsets()[j], intersectionItemOffsets()[j + 1]) in intersectionItems().
+    * Items are referenced by their index in the deduplicated item catalogue, UINT32_MAX meaning no item.
+    * All returned pointers stay valid until the snapshot is destroyed.
+    */
+    class ICwAPI3DConnectorAxisSnapshot
+    {
+    public:
+      virtual ~ICwAPI3DConnectorAxisSnapshot() noexcept = default;
+
+      /**
+       * \brief Destroys itself
+       */
+      virtual void destroy() = 0;
+
+      /**
+       * \brief Returns the number of axes
+       */
+      virtual uint32_t axisCount() = 0;
+      /**
+       * \brief Returns axisCount() axis IDs
+       */
+      virtual const elementID* axisIDs() = 0;
+      /**
+       * \brief Returns axisCount() catalogue indices of the bolt items, UINT32_MAX for axes without bolt
+       */
+      virtual const uint32_t* boltItems() = 0;
+      /**
+       * \brief Returns axisCount() + 1 offsets into sections()
+       */
+      virtual const uint32_t* sectionOffsets() = 0;
+      /**
+       * \brief Returns axisCount() + 1 offsets into the intersections
+       */
+      virtual const uint32_t* intersectionOffsets() = 0;
+
+      /**
+       * \brief Returns the total number of sections
+       */
+      virtual uint32_t sectionCount() = 0;
+      /**
+       * \brief Returns sectionCount() sections
+       */
+      virtual const connectorAxisSection* sections() = 0;
+      /**
+       * \brief Gets the material name of a section
+       * \param aSection index into sections()
+       */
+      virtual const character* sectionMaterialName(uint32_t aSection) = 0;
+
+      /**
+       * \brief Returns the total number of intersections
+       */
+      virtual uint32_t intersectionCount() = 0;
+      /**
+       * \brief Returns intersectionCount() + 1 offsets into intersectionItems()
+       */
+      virtual const uint32_t* intersectionItemOffsets() = 0;
+      /**
+       * \brief Returns the catalogue indices of the items at all intersections
+       */
+      virtual const uint32_t* intersectionItems() = 0;
+
+      /**
+       * \brief Returns the number of distinct items in the catalogue
+       */
+      virtual uint32_t itemCount() = 0;
+      /**
+       * \brief Gets the GUID of a catalogue item
+       * \param aItem catalogue index
+       * \return zero-terminated text, valid until the snapshot is destroyed, nullptr if aItem >= itemCount()
+       */
+      virtual const character* itemGuid(uint32_t aItem) = 0;
+      /**
+       * \brief Gets the name of a catalogue item, like ICwAPI3DConnectorAxisController::getAxisItemName
+       * \param aItem catalogue index
+       * \return zero-terminated text, valid until the snapshot is destroyed, nullptr if aItem >= itemCount()
+       */
+      virtual const character* itemName(uint32_t aItem) = 0;
+      /**
+       * \brief Gets the material of a catalogue item, like ICwAPI3DConnectorAxisController::getAxisItemMaterial
+       * \param aItem catalogue index
+       * \return zero-terminated text, valid until the snapshot is destroyed, nullptr if aItem >= itemCount()
+       */
+      virtual const character* itemMaterial(uint32_t aItem) = 0;
+      /**
+       * \brief Gets the norm of a catalogue item, like ICwAPI3DConnectorAxisController::getAxisItemNorm
+       * \param aItem catalogue index
+       * \return zero-terminated text, valid until the snapshot is destroyed, nullptr if aItem >= itemCount()
+       */
+      virtual const character* itemNorm(uint32_t aItem) = 0;
+      /**
+       * \brief Gets the strength category of a catalogue item, like ICwAPI3DConnectorAxisController::getAxisItemStrengthCategory
+       * \param aItem catalogue index
+       * \return zero-terminated text, valid until the snapshot is destroyed, nullptr if aItem >= itemCount()
+       */
+      virtual const character* itemStrengthCategory(uint32_t aItem) = 0;
+      /**
+       * \brief Gets the order number of a catalogue item, like ICwAPI3DConnectorAxisController::getAxisItemOrderNumber
+       * \param aItem catalogue index
+       * \return zero-terminated text, valid until the snapshot is destroyed, nullptr if aItem >= itemCount()
+       */
+      virtual const character* itemOrderNumber(uint32_t aItem) = 0;
+      /**
+       * \brief Gets a user field of a catalogue item, like ICwAPI3DConnectorAxisController::getAxisItemUserField
+       * \param aItem catalogue index
+       * \param aUserItemNumber user field number (1-5)
+       * \return zero-terminated text, valid until the snapshot is destroyed, nullptr if aItem >= itemCount() or the user field does not exist
+       */
+      virtual const character* itemUserField(uint32_t aItem, int32_t aUserItemNumber) = 0;
+    };
+  }
+}
@@ -15,10 +15,13 @@
 #include "ICwAPI3DAttributeController.h"
 #include "ICwAPI3DAttributeDisplaySettings.h"
 #include "ICwAPI3DBimController.h"
+#include "ICwAPI3DBuildingHierarchy.h"
 #include "ICwAPI3DCameraData.h"
 #include "ICwAPI3DConnectorAxisController.h"
+#include "ICwAPI3DConnectorAxisSnapshot.h"
 #include "ICwAPI3DCoordinateSystemData.h"
 #include "ICwAPI3DDimensionController.h"
+#include "ICwAPI3DDimensionSnapshot.h"
 #include "ICwAPI3DDisplayAttribute.h"
 #include "ICwAPI3DEdgeList.h"
 #include "ICwAPI3DElementController.h"
@@ -29,27 +32,37 @@
 #include "ICwAPI3DElementModuleProperties.h"
 #include "ICwAPI3DElementType.h"
 #include "ICwAPI3DEndtypeController.h"
+#include "ICwAPI3DEndtypeMatrix.h"
 #include "ICwAPI3DExtendedSettings.h"
 #include "ICwAPI3DFacetList.h"
 #include "ICwAPI3DFileController.h"
 #include "ICwAPI3DGeometryController.h"
 #include "ICwAPI3DGridController.h"
+#include "ICwAPI3DHiddenLineSink.h"
 #include "ICwAPI3DIfc2x3ElementType.h"
 #include "ICwAPI3DIfcOptions.h"
 #include "ICwAPI3DIfcPredefinedType.h"
 #include "ICwAPI3DImport3dcOptions.h"
 #include "ICwAPI3DLayerSettings.h"
+#include "ICwAPI3DLinearOptimization.h"
 #include "ICwAPI3DListController.h"
 #include "ICwAPI3DMachineController.h"
 #include "ICwAPI3DMaterialController.h"
 #include "ICwAPI3DMaterialIDList.h"
+#include "ICwAPI3DMaterialTable.h"
 #include "ICwAPI3DMenuController.h"
 #include "ICwAPI3DMultiLayerCoverController.h"
+#include "ICwAPI3DMultiLayerSetSnapshot.h"
+#include "ICwAPI3DNesting.h"
 #include "ICwAPI3DPolygonList.h"
 #include "ICwAPI3DProcessType.h"
+#include "ICwAPI3DProcessingTable.h"
+#include "ICwAPI3DProgressToken.h"
+#include "ICwAPI3DProjectDataTable.h"
 #include "ICwAPI3DRhinoOptions.h"
 #include "ICwAPI3DRoofController.h"
 #include "ICwAPI3DSceneController.h"
+#include "ICwAPI3DShopDrawingBatch.h"
 #include "ICwAPI3DShopDrawingController.h"
 #include "ICwAPI3DStringList.h"
 #include "ICwAPI3DUtilityController.h"
@@ -274,6 +287,26 @@ namespace CwAPI3D
       virtual ICwAPI3DEventSubscriptionController* getEventSubscriptionController() = 0;
 
       virtual ICwAPI3DHitResult* createEmptyHitResult() = 0;
+
+      /// @brief Creates linear optimization options
+      /// @return linear optimization options
+      virtual ICwAPI3DLinearOptimizationOptions* createLinearOptimizationOptions() = 0;
+
+      /// @brief Creates nesting options
+      /// @return nesting options
+      virtual ICwAPI3DNestingOptions* createNestingOptions() = 0;
+
+      /// @brief Creates an empty shop drawing batch
+      /// @return shop drawing batch
+      virtual ICwAPI3DShopDrawingBatch* createShopDrawingBatch() = 0;
+
+      /// @brief Creates an empty material update
+      /// @return material update
+      virtual ICwAPI3DMaterialUpdate* createMaterialUpdate() = 0;
+
+      /// @brief Creates a progress token
+      /// @return progress token
+      virtual ICwAPI3DProgressToken* createProgressToken() = 0;
     };
   }
 }
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "ICwAPI3DDimensionSnapshot.h"
 #include "ICwAPI3DElementIDList.h"
 #include "ICwAPI3DString.h"
 #include "ICwAPI3DVertexList.h"
@@ -173,6 +174,42 @@ namespace CwAPI3D
       /// @return [@ref DimensionBaseFormat] the format used for the dimension. Enum value `None` may indicate that something went during
       /// while retrieving the value due to e.g. the element not being a valid dimension.
       virtual CwAPI3D::DimensionBaseFormat getDimensionBaseFormat(const CwAPI3D::elementID aElementId) = 0;
+
+      /// @brief Creates many dimension elements in one pass.
+      /// @details Each definition is created like @ref createDimension with the points
+      /// aPoints[mFirstPoint] to aPoints[mFirstPoint + mPointCount - 1], then the style aStyles[mStyle] is applied.
+      /// @param[in] aDefinitions [const @ref dimensionDefinition*] The dimension definitions.
+      /// @param[in] aCount [uint32_t] The number of definitions.
+      /// @param[in] aPoints [const @ref vector3D*] The dimension points the definitions refer to.
+      /// @param[in] aStyles [const @ref dimensionStyle*] The styles the definitions refer to, may be nullptr if all use the default style.
+      /// @return [@ref ICwAPI3DElementIDList*] The created dimension element ids, in definition order.
+      /// @par Example:
+      /// @code{.cpp}
+      /// vector3D lPoints[] = {{0, 0, 0}, {1000, 0, 0}, {2500, 0, 0}, {0, 0, 0}, {0, 3000, 0}};
+      /// dimensionStyle lStyle = {50.0, 0.5, 100.0, 1, 1, 1, true, false};
+      /// dimensionDefinition lDefinitions[] = {
+      ///     {{1, 0, 0}, {0, 0, 1}, {0, -500, 0}, 0, 3, 0},
+      ///     {{0, 1, 0}, {0, 0, 1}, {-500, 0, 0}, 3, 2, 0}};
+      /// ICwAPI3DElementIDList* lDimensions = aFactory.getDimensionController()->createDimensions(lDefinitions, 2, lPoints, &lStyle);
+      /// @endcode
+      virtual ICwAPI3DElementIDList* createDimensions(const dimensionDefinition* aDefinitions, uint32_t aCount, const vector3D* aPoints, const dimensionStyle* aStyles) = 0;
+
+      /// @brief Gets the planes, points and segments of many dimension elements in one call.
+      /// @param[in] aElementIdList [@ref ICwAPI3DElementIDList*] The dimension element id list. Elements that are not dimensions get no points and segments.
+      /// @return [@ref ICwAPI3DDimensionSnapshot*] The snapshot.
+      /// @par Example:
+      /// @code{.cpp}
+      /// ICwAPI3DDimensionSnapshot* lSnapshot = aFactory.getDimensionController()->getDimensionSnapshot(lDimensions);
+      /// for (uint32_t i = 0; i < lSnapshot->count(); ++i)
+      /// {
+      ///     for (uint32_t s = lSnapshot->segmentOffsets()[i]; s < lSnapshot->segmentOffsets()[i + 1]; ++s)
+      ///     {
+      ///         printf("Dimension %llu: %f\n", lSnapshot->elementIDs()[i], lSnapshot->segmentDistances()[s]);
+      ///     }
+      /// }
+      /// lSnapshot->destroy();
+      /// @endcode
+      virtual ICwAPI3DDimensionSnapshot* getDimensionSnapshot(ICwAPI3DElementIDList* aElementIdList) = 0;
     };
   }
 }
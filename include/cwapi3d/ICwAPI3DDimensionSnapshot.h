@@ -0,0 +1,81 @@
+/** @file
+* Copyright (C) 2026 cadwork informatik AG
+*
+* This file is part of the CwAPI3D module for cadwork 3d.
+*
+* @ingroup       CwAPI3D
+* @since         32.0
+* @author        Paquet
+* @date          2026-10-18
+*/
+
+#pragma once
+
+#include "CwAPI3DTypes.h"
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    /**
+    * @interface ICwAPI3DDimensionSnapshot
+    * \brief Column-wise snapshot of dimension elements.
+    * Points of dimension i are [pointOffsets()[i], pointOffsets()[i + 1]), ordered by dimension direction,
+    * segments of dimension i are [segmentOffsets()[i], segmentOffsets()[i + 1]).
+    * All returned pointers stay valid until the snapshot is destroyed.
+    */
+    class ICwAPI3DDimensionSnapshot
+    {
+    public:
+      virtual ~ICwAPI3DDimensionSnapshot() noexcept = default;
+
+      /**
+       * \brief Destroys itself
+       */
+      virtual void destroy() = 0;
+
+      /**
+       * \brief Returns the number of dimensions
+       */
+      virtual uint32_t count() = 0;
+      /**
+       * \brief Returns count() dimension element IDs
+       */
+      virtual const elementID* elementIDs() = 0;
+      /**
+       * \brief Returns count() plane x directions
+       */
+      virtual const vector3D* planeXl() = 0;
+      /**
+       * \brief Returns count() plane normals
+       */
+      virtual const vector3D* planeNormals() = 0;
+      /**
+       * \brief Returns count() distance vectors
+       */
+      virtual const vector3D* distances() = 0;
+
+      /**
+       * \brief Returns count() + 1 offsets into points()
+       */
+      virtual const uint32_t* pointOffsets() = 0;
+      /**
+       * \brief Returns the dimension points of all dimensions
+       */
+      virtual const vector3D* points() = 0;
+
+      /**
+       * \brief Returns count() + 1 offsets into segmentDistances() and segmentDirections()
+       */
+      virtual const uint32_t* segmentOffsets() = 0;
+      /**
+       * \brief Returns the segment distances of all dimensions
+       */
+      virtual const double* segmentDistances() = 0;
+      /**
+       * \brief Returns the normalized segment directions of all dimensions
+       */
+      virtual const vector3D* segmentDirections() = 0;
+    };
+  }
+}
@@ -19,6 +19,9 @@
 #include "ICwAPI3DElementModuleProperties.h"
 #include "ICwAPI3DFacetList.h"
 #include "ICwAPI3DHitResult.h"
+#include "ICwAPI3DLinearOptimization.h"
+#include "ICwAPI3DNesting.h"
+#include "ICwAPI3DProgressToken.h"
 #include "ICwAPI3DString.h"
 #include "ICwAPI3DStringList.h"
 #include "ICwAPI3DTextObjectOptions.h"
@@ -495,6 +498,7 @@ namespace CwAPI3D
       virtual ICwAPI3DString* getElementCadworkGuid(elementID aElementId) = 0;
 
       /// @brief Retrieves the element ID from a Cadwork GUID.
+      /// @note Use @ref getElementsFromCadworkGuids to resolve many GUIDs.
       /// @param[in] aCadworkGuid [const @ref character*] The Cadwork GUID to retrieve the element ID from.
       /// @return [@ref elementID] The ID of the element.
       virtual elementID getElementFromCadworkGuid(const character* aCadworkGuid) = 0;
@@ -1796,6 +1800,97 @@ namespace CwAPI3D
       /// @brief Gets double shoulder cut options.
       /// @return Double shoulder options
       virtual ICwAPI3DDoubleShoulderOptions* getDoubleShoulderOptions() = 0;
+
+      /// @brief Solves a linear optimization (1D cutting stock) without creating optimization elements.
+      /// @details Starts from a first-fit-decreasing solution and improves it with a multithreaded local search until the time budget of the options is spent.
+      /// @param[in] aElementIdList [@ref ICwAPI3DElementIDList*] The list of elements to be optimized.
+      /// @param[in] aOptions [@ref ICwAPI3DLinearOptimizationOptions*] The stock lengths, cuts and solver settings.
+      /// @return [@ref ICwAPI3DLinearOptimizationResult*] The bars, the parts assigned to them and the waste.
+      /// @par Example:
+      /// @code{.cpp}
+      /// ICwAPI3DLinearOptimizationOptions* options = aFactory.createLinearOptimizationOptions();
+      /// const double stockLengths[] = {5000., 6000., 13000.};
+      /// options->setStockLengths(stockLengths, nullptr, 3);
+      /// options->setSawKerf(4.);
+      /// options->setTimeBudget(2000);
+      ///
+      /// ICwAPI3DLinearOptimizationResult* result = aFactory.getElementController()->solveLinearOptimization(beamElements, options);
+      /// printf("%u bars, yield %f\n", result->barCount(), result->yield());
+      /// result->destroy();
+      /// options->destroy();
+      /// @endcode
+      virtual ICwAPI3DLinearOptimizationResult* solveLinearOptimization(ICwAPI3DElementIDList* aElementIdList, ICwAPI3DLinearOptimizationOptions* aOptions) = 0;
+
+      /// @brief Nests panel elements onto raw sheets.
+      /// @details Placements are searched in parallel until the time budget of the options is spent.
+      /// If requested by the options, the nesting parents and children are created in the model.
+      /// @param[in] aElementIdList [@ref ICwAPI3DElementIDList*] The list of panel elements to nest.
+      /// @param[in] aOptions [@ref ICwAPI3DNestingOptions*] The sheet sizes, spacing and solver settings.
+      /// @return [@ref ICwAPI3DNestingResult*] The sheets, the parts placed on them and the utilisation.
+      /// @par Example:
+      /// @code{.cpp}
+      /// ICwAPI3DNestingOptions* options = aFactory.createNestingOptions();
+      /// const double lengths[] = {2500., 5000.};
+      /// const double widths[] = {1250., 2500.};
+      /// options->setSheetSizes(lengths, widths, nullptr, 2);
+      /// options->setPartSpacing(10.);
+      /// options->setTimeBudget(10000);
+      /// options->setCreateNestingElements(true);
+      ///
+      /// ICwAPI3DNestingResult* result = aFactory.getElementController()->nestPanels(panelElements, options);
+      /// printf("%u sheets, utilisation %f\n", result->sheetCount(), result->totalUtilisation());
+      /// result->destroy();
+      /// options->destroy();
+      /// @endcode
+      virtual ICwAPI3DNestingResult* nestPanels(ICwAPI3DElementIDList* aElementIdList, ICwAPI3DNestingOptions* aOptions) = 0;
+
+      /// @brief Retrieves the covers whose element module is affected by changes since their last calculation.
+      /// @param[in] aCoverIdList [@ref ICwAPI3DElementIDList*] The list of covers to check.
+      /// @return [@ref ICwAPI3DElementIDList*] The covers that need to be recalculated.
+      virtual ICwAPI3DElementIDList* getOutdatedElementModuleCovers(ICwAPI3DElementIDList* aCoverIdList) = 0;
+
+      /// @brief Marks the element module of the given covers as outdated, so that they are recalculated on the next incremental call.
+      /// @details Use it before @ref startElementModuleCalculationIncremental to force a full recalculation with a progress token.
+      /// @param[in] aCoverIdList [@ref ICwAPI3DElementIDList*] The list of covers.
+      /// @par Example:
+      /// @code{.cpp}
+      /// aFactory.getElementController()->invalidateElementModule(walls);
+      /// ICwAPI3DElementIDList* recalculated = aFactory.getElementController()->startElementModuleCalculationIncremental(walls, token);
+      /// @endcode
+      virtual void invalidateElementModule(ICwAPI3DElementIDList* aCoverIdList) = 0;
+
+      /// @brief Calculates the element module silently, only for the covers affected by changes since their last calculation.
+      /// @details Covers that do not depend on each other are calculated in parallel.
+      /// Progress is reported per cover through aToken, which is checked between covers. On cancellation the covers already
+      /// recalculated are kept and up to date, the others stay outdated and are recalculated by the next call.
+      /// @param[in] aCoverIdList [@ref ICwAPI3DElementIDList*] The list of covers for which to calculate the element module.
+      /// @param[in] aToken [@ref ICwAPI3DProgressToken*] The progress token, may be nullptr.
+      /// @return [@ref ICwAPI3DElementIDList*] The covers that were recalculated, before the end of the call or its cancellation.
+      /// @par Example:
+      /// @code{.cpp}
+      /// ICwAPI3DElementIDList* recalculated = aFactory.getElementController()->startElementModuleCalculationIncremental(walls, nullptr);
+      /// for (uint32_t i = 0; i < recalculated->count(); ++i)
+      /// {
+      ///     elementID cover = recalculated->at(i);
+      ///     printf("Cover %llu: %f ms\n", cover, aFactory.getElementController()->getElementModuleCalculationTime(cover));
+      /// }
+      /// @endcode
+      virtual ICwAPI3DElementIDList* startElementModuleCalculationIncremental(ICwAPI3DElementIDList* aCoverIdList, ICwAPI3DProgressToken* aToken) = 0;
+
+      /// @brief Retrieves the duration of the last element module calculation of a cover.
+      /// @param[in] aCoverId [@ref elementID] The cover ID.
+      /// @return [double] The duration in milliseconds, or a negative value if the cover has not been calculated yet.
+      virtual double getElementModuleCalculationTime(elementID aCoverId) = 0;
+
+      /// @brief Retrieves the element IDs of many Cadwork GUIDs in one call, using a hash index.
+      /// @param[in] aCadworkGuids [@ref ICwAPI3DStringList*] The Cadwork GUIDs.
+      /// @return [@ref ICwAPI3DElementIDList*] One element ID per GUID, in the same order, 0 for GUIDs that match no element.
+      virtual ICwAPI3DElementIDList* getElementsFromCadworkGuids(ICwAPI3DStringList* aCadworkGuids) = 0;
+
+      /// @brief Retrieves the Cadwork GUIDs of many elements in one call.
+      /// @param[in] aElementIdList [@ref ICwAPI3DElementIDList*] The list of elements.
+      /// @return [@ref ICwAPI3DStringList*] One Cadwork GUID per element, in the same order.
+      virtual ICwAPI3DStringList* getElementCadworkGuids(ICwAPI3DElementIDList* aElementIdList) = 0;
     };
   }
 }
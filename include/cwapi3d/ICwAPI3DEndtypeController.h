@@ -12,6 +12,8 @@
 
 #include "ICwAPI3DString.h"
 #include "ICwAPI3DEndtypeIDList.h"
+#include "ICwAPI3DEndtypeMatrix.h"
+#include "ICwAPI3DElementIDList.h"
 
 namespace CwAPI3D
 {
@@ -339,6 +341,26 @@ namespace CwAPI3D
       /// printf("User selected endtype ID: %d\n", selectedEndtypeId);
       /// @endcode
       virtual endtypeID startEndtypeDialog() = 0;
+
+      /// @brief Gets the start, end and face endtype IDs of many elements, with the names of the endtypes that appear.
+      /// @param[in] aElementIdList [@ref ICwAPI3DElementIDList*] The element id list.
+      /// @return [@ref ICwAPI3DEndtypeMatrix*] One row per element, one column per @ref endtypeSlot::endtypeSlot.
+      /// @par Example:
+      /// @code{.cpp}
+      /// ICwAPI3DElementIDList* elements = aFactory.getElementController()->getAllIdentifiableElementIDs();
+      /// ICwAPI3DEndtypeMatrix* matrix = aFactory.getEndtypeController()->getEndtypeMatrix(elements);
+      ///
+      /// for (uint32_t i = 0; i < matrix->count(); ++i)
+      /// {
+      ///     const endtypeID start = matrix->at(i, endtypeSlot::Start);
+      ///     if (start != 0)
+      ///     {
+      ///         printf("Start endtype: %ls\n", matrix->endtypeName(start));
+      ///     }
+      /// }
+      /// matrix->destroy();
+      /// @endcode
+      virtual ICwAPI3DEndtypeMatrix* getEndtypeMatrix(ICwAPI3DElementIDList* aElementIdList) = 0;
     };
   }
 }
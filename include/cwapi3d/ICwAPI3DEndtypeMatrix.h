@@ -0,0 +1,71 @@
+/** @file
+* Copyright (C) 2026 cadwork informatik AG
+*
+* This file is part of the CwAPI3D module for cadwork 3d.
+*
+* @ingroup       CwAPI3D
+* @since         32.0
+* @author        Paquet
+* @date          2026-10-18
+*/
+
+#pragma once
+
+#include "CwAPI3DTypes.h"
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    /**
+    * @interface ICwAPI3DEndtypeMatrix
+    * \brief Endtype IDs of several elements, one row of endtypeSlot::Count IDs per element,
+    * with the names of all endtypes that appear in it.
+    * All returned pointers stay valid until the matrix is destroyed.
+    */
+    class ICwAPI3DEndtypeMatrix
+    {
+    public:
+      virtual ~ICwAPI3DEndtypeMatrix() noexcept = default;
+
+      /**
+       * \brief Destroys itself
+       */
+      virtual void destroy() = 0;
+      /**
+       * \brief Returns the number of elements (rows)
+       * \return number of rows
+       */
+      virtual uint32_t count() = 0;
+      /**
+       * \brief Gets the endtype IDs, row-major: the ID of slot s of element i is at i * endtypeSlot::Count + s.
+       * Slots without endtype, and faces the element does not have, hold 0.
+       * \return pointer to count() * endtypeSlot::Count endtype IDs
+       */
+      virtual const endtypeID* ids() = 0;
+      /**
+       * \brief Gets the endtype ID of one slot
+       * \param aRow row index
+       * \param aSlot slot, see @ref endtypeSlot::endtypeSlot
+       * \return endtype ID, 0 if there is none
+       */
+      virtual endtypeID at(uint32_t aRow, uint32_t aSlot) = 0;
+      /**
+       * \brief Returns the number of distinct endtypes in the matrix
+       * \return number of dictionary entries
+       */
+      virtual uint32_t endtypeCount() = 0;
+      /**
+       * \brief Gets the distinct endtype IDs of the dictionary
+       * \return pointer to endtypeCount() endtype IDs
+       */
+      virtual const endtypeID* endtypeIDs() = 0;
+      /**
+       * \brief Gets the name of an endtype of the dictionary
+       * \param aEndtypeId endtype ID
+       * \return name, nullptr if the endtype does not appear in the matrix
+       */
+      virtual const character* endtypeName(endtypeID aEndtypeId) = 0;
+    };
+  }
+}
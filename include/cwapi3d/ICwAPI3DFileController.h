@@ -13,6 +13,7 @@
 #include "ICwAPI3DDisplayAttribute.h"
 #include "ICwAPI3DElementIDList.h"
 #include "ICwAPI3DImport3dcOptions.h"
+#include "ICwAPI3DProgressToken.h"
 #include "ICwAPI3DRhinoOptions.h"
 #include "ICwAPI3DString.h"
 
@@ -377,6 +378,14 @@ namespace CwAPI3D
       /// @param[in] aFilePath [const @ref character*] The output file path.
       /// @return [bool] True on successful export, false otherwise.
       virtual bool exportDstvFile(const CwAPI3D::character* aFilePath) = 0;
+
+      /// @brief Imports a STEP file without messages, reporting progress and stopping when the token is cancelled.
+      /// @details The import is a single transaction: on cancellation it is rolled back and no elements are imported.
+      /// @param[in] aFilePath [const @ref character*] The input file path.
+      /// @param[in] aScaleFactor [double] The file scale factor.
+      /// @param[in] aToken [@ref ICwAPI3DProgressToken*] The progress token.
+      /// @return [@ref ICwAPI3DElementIDList*] The imported list of element id, empty if the import was cancelled or failed.
+      virtual ICwAPI3DElementIDList* importStepFileWithProgress(const character* aFilePath, double aScaleFactor, ICwAPI3DProgressToken* aToken) = 0;
     };
   }
 }
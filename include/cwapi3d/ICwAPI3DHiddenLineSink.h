@@ -0,0 +1,41 @@
+/** @file
+* Copyright (C) 2026 cadwork informatik AG
+*
+* This file is part of the CwAPI3D module for cadwork 3d.
+*
+* @ingroup       CwAPI3D
+* @since         32.0
+* @author        Paquet
+* @date          2026-10-18
+*/
+
+#pragma once
+
+#include "CwAPI3DTypes.h"
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    /**
+    * @interface ICwAPI3DHiddenLineSink
+    * \brief Receiver of hidden line segments, implemented by the plugin.
+    * Batches are delivered one at a time on the calling thread, so implementations need no synchronization.
+    */
+    class ICwAPI3DHiddenLineSink
+    {
+    public:
+      virtual ~ICwAPI3DHiddenLineSink() noexcept = default;
+
+      /**
+       * \brief Receives a batch of segments. The arrays are only valid during the call.
+       * \param aStartPoints segment start points in view coordinates, z is the depth
+       * \param aEndPoints segment end points in view coordinates, z is the depth
+       * \param aTypes visibility of each segment
+       * \param aElementIDs element each segment belongs to
+       * \param aCount number of segments in the batch
+       */
+      virtual void addSegments(const vector3D* aStartPoints, const vector3D* aEndPoints, const HiddenLineSegmentType* aTypes, const elementID* aElementIDs, uint32_t aCount) = 0;
+    };
+  }
+}
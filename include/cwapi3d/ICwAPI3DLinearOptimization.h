@@ -0,0 +1,137 @@
+/** @file
+* Copyright (C) 2026 cadwork informatik AG
+*
+* This file is part of the CwAPI3D module for cadwork 3d.
+*
+* @ingroup       CwAPI3D
+* @since         32.0
+* @author        Paquet
+* @date          2026-10-18
+*/
+
+#pragma once
+
+#include "CwAPI3DTypes.h"
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    /**
+    * @interface ICwAPI3DLinearOptimizationOptions
+    * \brief Input of the 1D cutting-stock solver
+    */
+    class ICwAPI3DLinearOptimizationOptions
+    {
+    public:
+      virtual ~ICwAPI3DLinearOptimizationOptions() noexcept = default;
+
+      virtual void destroy() = 0;
+
+      /**
+       * \brief Sets the available stock lengths
+       * \param aLengths stock lengths
+       * \param aAvailableCounts number of available bars per stock length, 0 for unlimited. May be nullptr if all are unlimited.
+       * \param aCount number of stock lengths
+       */
+      virtual void setStockLengths(const double* aLengths, const uint32_t* aAvailableCounts, uint32_t aCount) = 0;
+      virtual uint32_t getStockLengthCount() const = 0;
+      virtual double getStockLength(uint32_t aIndex) const = 0;
+      virtual uint32_t getStockAvailableCount(uint32_t aIndex) const = 0;
+
+      virtual double getSawKerf() const = 0;
+      virtual void setSawKerf(double aValue) = 0;
+
+      virtual double getStartCut() const = 0;
+      virtual void setStartCut(double aValue) = 0;
+
+      virtual double getEndCut() const = 0;
+      virtual void setEndCut(double aValue) = 0;
+
+      /**
+       * \brief Time the search may take after the initial first-fit-decreasing solution, in milliseconds. 0 returns the initial solution.
+       */
+      virtual uint32_t getTimeBudget() const = 0;
+      virtual void setTimeBudget(uint32_t aMilliseconds) = 0;
+
+      /**
+       * \brief Number of search threads, 0 for one per core
+       */
+      virtual uint32_t getThreadCount() const = 0;
+      virtual void setThreadCount(uint32_t aValue) = 0;
+
+      /**
+       * \brief Uses production list lengths instead of element lengths
+       */
+      virtual bool getUseProductionList() const = 0;
+      virtual void setUseProductionList(bool aValue) = 0;
+    };
+
+    /**
+    * @interface ICwAPI3DLinearOptimizationResult
+    * \brief Solution of the 1D cutting-stock solver.
+    * Parts are grouped by bar: the parts of bar i are [barPartOffsets()[i], barPartOffsets()[i + 1]).
+    * All returned pointers stay valid until the result is destroyed.
+    */
+    class ICwAPI3DLinearOptimizationResult
+    {
+    public:
+      virtual ~ICwAPI3DLinearOptimizationResult() noexcept = default;
+
+      virtual void destroy() = 0;
+
+      /**
+       * \brief Returns the number of bars used
+       */
+      virtual uint32_t barCount() const = 0;
+      /**
+       * \brief Returns barCount() indices into the stock lengths of the options
+       */
+      virtual const uint32_t* barStockIndices() const = 0;
+      /**
+       * \brief Returns barCount() remaining lengths, including start and end cut
+       */
+      virtual const double* barWaste() const = 0;
+      /**
+       * \brief Returns barCount() + 1 offsets into the part arrays
+       */
+      virtual const uint32_t* barPartOffsets() const = 0;
+
+      /**
+       * \brief Returns the number of placed parts
+       */
+      virtual uint32_t partCount() const = 0;
+      /**
+       * \brief Returns partCount() element IDs, grouped by bar
+       */
+      virtual const elementID* partElementIDs() const = 0;
+      /**
+       * \brief Returns partCount() start positions of the parts on their bar
+       */
+      virtual const double* partPositions() const = 0;
+      /**
+       * \brief Returns partCount() part lengths
+       */
+      virtual const double* partLengths() const = 0;
+
+      /**
+       * \brief Returns the elements that fit on none of the stock lengths
+       */
+      virtual uint32_t unplacedCount() const = 0;
+      virtual const elementID* unplacedElementIDs() const = 0;
+
+      /**
+       * \brief Returns the sum of all bar waste
+       */
+      virtual double totalWaste() const = 0;
+      /**
+       * \brief Returns the placed part length divided by the used stock length
+       */
+      virtual double yield() const = 0;
+      /**
+       * \brief Returns the solver run time in milliseconds
+       */
+      virtual uint32_t elapsedTime() const = 0;
+    };
+  }
+}
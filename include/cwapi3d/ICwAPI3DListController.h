@@ -99,6 +99,37 @@ namespace CwAPI3D
       /// @param[in] aExportFilePath [const @ref character*] The exported file path.
       /// @param[in] aSettingsFilePath [const @ref character*] The settings file path.
       virtual void exportCoverListWithSettings(ICwAPI3DElementIDList* aElementIdList, const character* aExportFilePath, const character* aSettingsFilePath) = 0;
+
+      /// @brief Exports a production list while it is calculated.
+      /// @details Rows are calculated in parallel and written to the file in list order as soon as they are available,
+      /// so the whole list is never held in memory before the first row is written.
+      /// @param[in] aElementIdList [@ref ICwAPI3DElementIDList*] The element list id.
+      /// @param[in] aExportFilePath [const @ref character*] The exported file path.
+      /// @param[in] aSettingsFilePath [const @ref character*] The settings file path, or an empty string for the current settings.
+      /// @param[in] aFormat [@ref ListExportFormat] The export file format. The layout of the columnar format is described on @ref ListExportFormat.
+      /// @par Example:
+      /// @code{.cpp}
+      /// ICwAPI3DElementIDList* elements = aFactory.getElementController()->getAllIdentifiableElementIDs();
+      ///
+      /// aFactory.getListController()->exportProductionListStreamed(elements, L"C:/exports/production.bin", L"", ListExportFormat::Columnar);
+      /// @endcode
+      virtual void exportProductionListStreamed(ICwAPI3DElementIDList* aElementIdList, const character* aExportFilePath, const character* aSettingsFilePath, ListExportFormat aFormat) = 0;
+
+      /// @brief Exports a part list while it is calculated.
+      /// @details See @ref exportProductionListStreamed for the streaming behaviour.
+      /// @param[in] aElementIdList [@ref ICwAPI3DElementIDList*] The element list id.
+      /// @param[in] aExportFilePath [const @ref character*] The exported file path.
+      /// @param[in] aSettingsFilePath [const @ref character*] The settings file path, or an empty string for the current settings.
+      /// @param[in] aFormat [@ref ListExportFormat] The export file format.
+      virtual void exportPartListStreamed(ICwAPI3DElementIDList* aElementIdList, const character* aExportFilePath, const character* aSettingsFilePath, ListExportFormat aFormat) = 0;
+
+      /// @brief Exports a Wall/Roof/Floor list while it is calculated.
+      /// @details See @ref exportProductionListStreamed for the streaming behaviour.
+      /// @param[in] aElementIdList [@ref ICwAPI3DElementIDList*] The element list id.
+      /// @param[in] aExportFilePath [const @ref character*] The exported file path.
+      /// @param[in] aSettingsFilePath [const @ref character*] The settings file path, or an empty string for the current settings.
+      /// @param[in] aFormat [@ref ListExportFormat] The export file format.
+      virtual void exportCoverListStreamed(ICwAPI3DElementIDList* aElementIdList, const character* aExportFilePath, const character* aSettingsFilePath, ListExportFormat aFormat) = 0;
     };
   }
 }
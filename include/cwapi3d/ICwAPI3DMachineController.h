@@ -11,6 +11,8 @@
 #pragma once
 
 #include "ICwAPI3DElementIDList.h"
+#include "ICwAPI3DProcessingTable.h"
+#include "ICwAPI3DProgressToken.h"
 #include "ICwAPI3DString.h"
 #include "ICwAPI3DStringList.h"
 #include "ICwAPI3DVertexList.h"
@@ -255,6 +257,92 @@ namespace CwAPI3D
       /// aFactory.getMachineController()->exportHundeggerWithFilePathAndPresettingSilent(static_cast<uint32_t>(hundeggerType), outputPath, presettingFile);
       /// @endcode
       virtual void exportHundeggerWithFilePathAndPresettingSilent(uint32_t aHundeggertype, const character* aExportFilePath, const character* aPresetting) = 0;
+
+      /// @brief Calculates the Machine Data for BTL, recalculating only elements whose cached data is outdated.
+      /// @details Elements are calculated in parallel. The results are cached per element, keyed by the geometry hash and the BTL version.
+      /// Progress is reported per element through aToken, which is checked between elements. On cancellation the elements already
+      /// recalculated are cached, the others stay outdated and are recalculated by the next call.
+      /// @param[in] aElementIdList [@ref ICwAPI3DElementIDList*] The list of element Id.
+      /// @param[in] aBTLVersion [@ref btlVersion] The BTL version.
+      /// @param[in] aToken [@ref ICwAPI3DProgressToken*] The progress token, may be nullptr.
+      /// @return [uint32_t] The number of elements that were recalculated, before the end of the call or its cancellation.
+      /// @par Example:
+      /// @code{.cpp}
+      /// ICwAPI3DElementIDList* beamElements = aFactory.getElementController()->getAllIdentifiableElementIDs();
+      /// btlVersion btlVersion = btlVersion::btlx_2_1;
+      ///
+      /// uint32_t recalculated = aFactory.getMachineController()->calculateBTLMachineDataIncremental(beamElements, static_cast<uint32_t>(btlVersion), nullptr);
+      /// printf("Recalculated %u of %u elements\n", recalculated, beamElements->count());
+      /// @endcode
+      virtual uint32_t calculateBTLMachineDataIncremental(ICwAPI3DElementIDList* aElementIdList, uint32_t aBTLVersion, ICwAPI3DProgressToken* aToken) = 0;
+
+      /// @brief Calculates the Machine Data for Hundegger, recalculating only elements whose cached data is outdated.
+      /// @details Elements are calculated in parallel. The results are cached per element, keyed by the geometry hash and the machine type.
+      /// Progress is reported per element through aToken, which is checked between elements. On cancellation the elements already
+      /// recalculated are cached, the others stay outdated and are recalculated by the next call.
+      /// @param[in] aElementIdList [@ref ICwAPI3DElementIDList*] The list of element Id.
+      /// @param[in] aHundeggertype [@ref hundeggerMachineType] The Hundegger machine type.
+      /// @param[in] aToken [@ref ICwAPI3DProgressToken*] The progress token, may be nullptr.
+      /// @return [uint32_t] The number of elements that were recalculated, before the end of the call or its cancellation.
+      virtual uint32_t calculateHundeggerMachineDataIncremental(ICwAPI3DElementIDList* aElementIdList, uint32_t aHundeggertype, ICwAPI3DProgressToken* aToken) = 0;
+
+      /// @brief Gets the elements whose cached BTL Machine Data is missing or outdated.
+      /// @param[in] aElementIdList [@ref ICwAPI3DElementIDList*] The list of element Id.
+      /// @param[in] aBTLVersion [@ref btlVersion] The BTL version.
+      /// @return [@ref ICwAPI3DElementIDList*] The elements that would be recalculated.
+      virtual ICwAPI3DElementIDList* getOutdatedBTLMachineDataElements(ICwAPI3DElementIDList* aElementIdList, uint32_t aBTLVersion) = 0;
+
+      /// @brief Gets the elements whose cached Hundegger Machine Data is missing or outdated.
+      /// @param[in] aElementIdList [@ref ICwAPI3DElementIDList*] The list of element Id.
+      /// @param[in] aHundeggertype [@ref hundeggerMachineType] The Hundegger machine type.
+      /// @return [@ref ICwAPI3DElementIDList*] The elements that would be recalculated.
+      virtual ICwAPI3DElementIDList* getOutdatedHundeggerMachineDataElements(ICwAPI3DElementIDList* aElementIdList, uint32_t aHundeggertype) = 0;
+
+      /// @brief Discards the cached Machine Data of the given elements, so that they are recalculated on the next call.
+      /// @param[in] aElementIdList [@ref ICwAPI3DElementIDList*] The list of element Id.
+      virtual void invalidateMachineData(ICwAPI3DElementIDList* aElementIdList) = 0;
+
+      /// @brief Gets the BTL processings of several elements as one flat table.
+      /// @details Replaces the per-processing calls to @ref getProcessingName, @ref getProcessingCode, @ref getProcessingPoints and
+      /// @ref getProcessingBTLParameterset. Parameters are returned as numbers keyed by their BTL parameter ID;
+      /// parameters without a numeric value are only available through @ref getProcessingBTLParameterset.
+      /// @param[in] aElementIdList [@ref ICwAPI3DElementIDList*] The list of element Id.
+      /// @param[in] aBTLVersion [@ref btlVersion] The BTL version.
+      /// @return [@ref ICwAPI3DProcessingTable*] The processing table, one row per processing.
+      /// @par Example:
+      /// @code{.cpp}
+      /// ICwAPI3DElementIDList* beamElements = aFactory.getElementController()->getAllIdentifiableElementIDs();
+      /// btlVersion btlVersion = btlVersion::btlx_2_1;
+      ///
+      /// ICwAPI3DProcessingTable* table = aFactory.getMachineController()->getBTLProcessingTable(beamElements, static_cast<uint32_t>(btlVersion));
+      /// for (uint32_t i = 0; i < table->count(); ++i)
+      /// {
+      ///     double depth = 0.;
+      ///     if (table->parameterValue(i, 4, &depth))
+      ///     {
+      ///         printf("%ls P04 = %f\n", table->code(i), depth);
+      ///     }
+      /// }
+      /// table->destroy();
+      /// @endcode
+      virtual ICwAPI3DProcessingTable* getBTLProcessingTable(ICwAPI3DElementIDList* aElementIdList, uint32_t aBTLVersion) = 0;
+
+      /// @brief Exports a BTL file for the given elements instead of the active selection.
+      /// @details Each part is serialized independently on a worker thread and written to the file in list order as soon as
+      /// it is ready, so the complete document is never held in memory.
+      /// @param[in] aElementIdList [@ref ICwAPI3DElementIDList*] The list of element Id.
+      /// @param[in] aBTLVersion [@ref btlVersion] The BTL version.
+      /// @param[in] aExportFilePath [const @ref character*] The export file path.
+      /// @param[in] aPresetting [const @ref character*] The presetting file path (.xml), or an empty string for the current settings.
+      /// @par Example:
+      /// @code{.cpp}
+      /// ICwAPI3DElementIDList* beamElements = aFactory.getElementController()->getAllIdentifiableElementIDs();
+      /// btlVersion btlVersion = btlVersion::btlx_2_1;
+      /// const character* outputPath = L"C:/exports/timber_project.btlx";
+      ///
+      /// aFactory.getMachineController()->exportBTLForElements(beamElements, static_cast<uint32_t>(btlVersion), outputPath, L"");
+      /// @endcode
+      virtual void exportBTLForElements(ICwAPI3DElementIDList* aElementIdList, uint32_t aBTLVersion, const character* aExportFilePath, const character* aPresetting) = 0;
     };
   }
 }
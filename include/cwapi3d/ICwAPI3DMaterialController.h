@@ -11,6 +11,7 @@
 #pragma once
 
 #include "ICwAPI3DMaterialIDList.h"
+#include "ICwAPI3DMaterialTable.h"
 #include "ICwAPI3DString.h"
 #include "ICwAPI3DStringList.h"
 
@@ -427,6 +428,34 @@ namespace CwAPI3D
       /// @param[in] aMaterialId [@ref materialID] The material id.
       /// @param[in] aValue [double] The zoom factor to set.
       virtual void setTextureZoomY(materialID aMaterialId, double aValue) = 0;
+
+      /// @brief Gets all materials and their properties as one column-wise table.
+      /// @return [@ref ICwAPI3DMaterialTable*] The material table.
+      /// @par Example:
+      /// @code{.cpp}
+      /// ICwAPI3DMaterialTable* table = aFactory.getMaterialController()->getMaterialTable();
+      /// const double* prices = table->numberColumn(MaterialProperty::Price);
+      /// for (uint32_t i = 0; i < table->count(); ++i)
+      /// {
+      ///     printf("%ls: %f\n", table->text(MaterialProperty::Name, i), prices[i]);
+      /// }
+      /// table->destroy();
+      /// @endcode
+      virtual ICwAPI3DMaterialTable* getMaterialTable() = 0;
+
+      /// @brief Applies all changes of a material update in one transaction.
+      /// @param[in] aUpdate [@ref ICwAPI3DMaterialUpdate*] The changes to apply.
+      /// @return [bool] True if all changes were applied, false otherwise. On failure no change is applied.
+      /// @par Example:
+      /// @code{.cpp}
+      /// ICwAPI3DMaterialUpdate* update = aFactory.createMaterialUpdate();
+      /// update->setNumber(spruce, MaterialProperty::Price, 480.);
+      /// update->setText(spruce, MaterialProperty::FireResistanceClass, L"D-s2,d0");
+      ///
+      /// aFactory.getMaterialController()->applyMaterialUpdate(update);
+      /// update->destroy();
+      /// @endcode
+      virtual bool applyMaterialUpdate(ICwAPI3DMaterialUpdate* aUpdate) = 0;
     };
   }
 }
@@ -0,0 +1,110 @@
+/** @file
+* Copyright (C) 2026 cadwork informatik AG
+*
+* This file is part of the CwAPI3D module for cadwork 3d.
+*
+* @ingroup       CwAPI3D
+* @since         32.0
+* @author        Paquet
+* @date          2026-10-18
+*/
+
+#pragma once
+
+#include "CwAPI3DTypes.h"
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    /**
+    * @interface ICwAPI3DMaterialTable
+    * \brief Column-wise snapshot of all materials and their properties.
+    * Numeric properties are stored as double columns, text properties as one character arena per column.
+    * All returned pointers stay valid until the table is destroyed.
+    */
+    class ICwAPI3DMaterialTable
+    {
+    public:
+      virtual ~ICwAPI3DMaterialTable() noexcept = default;
+
+      /**
+       * \brief Destroys itself
+       */
+      virtual void destroy() = 0;
+      /**
+       * \brief Returns the number of materials
+       * \return number of rows
+       */
+      virtual uint32_t count() = 0;
+      /**
+       * \brief Gets the material ID column
+       * \return pointer to count() material IDs
+       */
+      virtual const materialID* materialIDs() = 0;
+      /**
+       * \brief Gets a numeric property column
+       * \param aProperty property
+       * \return pointer to count() values, nullptr for text properties
+       */
+      virtual const double* numberColumn(MaterialProperty aProperty) = 0;
+      /**
+       * \brief Gets the arena of a text property column. Row i is the zero-terminated string starting at textOffsets(aProperty)[i].
+       * \param aProperty property
+       * \return pointer to the character arena, nullptr for numeric properties
+       */
+      virtual const character* textArena(MaterialProperty aProperty) = 0;
+      /**
+       * \brief Gets the row offsets into a text property arena
+       * \param aProperty property
+       * \return pointer to count() + 1 offsets, the last one being the arena size, nullptr for numeric properties
+       */
+      virtual const uint32_t* textOffsets(MaterialProperty aProperty) = 0;
+      /**
+       * \brief Gets a single text value
+       * \param aProperty property
+       * \param aRow row index
+       * \return zero-terminated text, nullptr for numeric properties
+       */
+      virtual const character* text(MaterialProperty aProperty, uint32_t aRow) = 0;
+    };
+
+    /**
+    * @interface ICwAPI3DMaterialUpdate
+    * \brief Collection of material property changes, applied together by ICwAPI3DMaterialController::applyMaterialUpdate
+    */
+    class ICwAPI3DMaterialUpdate
+    {
+    public:
+      virtual ~ICwAPI3DMaterialUpdate() noexcept = default;
+
+      /**
+       * \brief Destroys itself
+       */
+      virtual void destroy() = 0;
+      /**
+       * \brief Records a change of a numeric property
+       * \param aMaterialId material
+       * \param aProperty numeric property
+       * \param aValue new value
+       */
+      virtual void setNumber(materialID aMaterialId, MaterialProperty aProperty, double aValue) = 0;
+      /**
+       * \brief Records a change of a text property
+       * \param aMaterialId material
+       * \param aProperty text property
+       * \param aValue new value, copied
+       */
+      virtual void setText(materialID aMaterialId, MaterialProperty aProperty, const character* aValue) = 0;
+      /**
+       * \brief Returns the number of recorded changes
+       * \return number of changes
+       */
+      virtual uint32_t count() = 0;
+      /**
+       * \brief Discards all recorded changes
+       */
+      virtual void clear() = 0;
+    };
+  }
+}
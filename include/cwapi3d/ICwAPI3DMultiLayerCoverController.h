@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "ICwAPI3DMultiLayerSetSnapshot.h"
 #include "ICwAPI3DString.h"
 
 #include <vector>
@@ -405,6 +406,53 @@ namespace CwAPI3D
       /// @param[in] aBeamGuid [@ref character*] The layer standard beam guid.
       /// @param[in] aThickness [double] The layer thickness.
       virtual void addLayerByStandardElements(multiLayerSetID aSetId, multiLayerType aType, const character* aName, const character* aPanelGuid, const character* aBeamGuid, double aThickness) = 0;
+
+      /// @brief Gets all multi layer sets with their layers in one call.
+      /// @return [@ref ICwAPI3DMultiLayerSetSnapshot*] The snapshot.
+      /// @par Example:
+      /// @code{.cpp}
+      ///     ICwAPI3DMultiLayerSetSnapshot* snapshot = aFactory->getMultiLayerCoverController()->getMultiLayerSetSnapshot();
+      ///     const character* text = snapshot->textArena();
+      ///     for (uint32_t i = 0; i < snapshot->setCount(); ++i)
+      ///     {
+      ///         const multiLayerSet& set = snapshot->sets()[i];
+      ///         wprintf(L"Set %ls\n", text + set.mName);
+      ///         for (uint32_t l = set.mFirstLayer; l < set.mFirstLayer + set.mLayerCount; ++l)
+      ///         {
+      ///             const multiLayerLayer& layer = snapshot->layers()[l];
+      ///             wprintf(L"  %ls: %.2fmm\n", text + layer.mName, layer.mThickness);
+      ///         }
+      ///     }
+      ///     snapshot->destroy();
+      /// @endcode
+      virtual ICwAPI3DMultiLayerSetSnapshot* getMultiLayerSetSnapshot() = 0;
+
+      /// @brief Creates a new multi layer wall with its cover settings and all its layers in one transaction.
+      /// @details The set name, cover name, cover material, cover thickness, cover color and component type are taken from aSet,
+      /// its mId is ignored. The layers are aLayers[aSet->mFirstLayer] to aLayers[aSet->mFirstLayer + aSet->mLayerCount - 1].
+      /// Layers with a standard panel or beam guid are added like @ref addLayerByStandardElements, the others like @ref addLayer;
+      /// the sub type of every layer is then applied like @ref setLayerSubType.
+      /// The arguments of @ref getMultiLayerSetSnapshot results can be passed as they are to copy a set.
+      /// If the set or a layer is invalid, no set is created.
+      /// @param[in] aSet [const @ref multiLayerSet*] The set settings and the range of its layers.
+      /// @param[in] aLayers [const @ref multiLayerLayer*] The layer array aSet refers to.
+      /// @param[in] aTextArena [const @ref character*] The arena the string offsets of the set and the layers refer to.
+      /// @return [@ref multiLayerSetID] The multi layer set id, 0 if the set could not be created.
+      /// @par Example:
+      /// @code{.cpp}
+      ///     const character text[] = L"Exterior Wall\0Cladding\0Insulation\0";
+      ///     multiLayerSet set = {0, claddingMaterialId, 180.0, 3, multiLayerComponentType::Material, 0, 14, 0, 2};
+      ///     multiLayerLayer layers[2] = {};
+      ///     layers[0] = {claddingMaterialId, 20.0, multiLayerType::Covering, multiLayerSubType::Undefined, 14, 13, 13};
+      ///     layers[1] = {insulationMaterialId, 160.0, multiLayerType::Structure, multiLayerSubType::SolidStructure, 23, 13, 13};
+      ///     multiLayerSetID setId = aFactory->getMultiLayerCoverController()->createMultiLayerWallWithLayers(&set, layers, text);
+      ///
+      ///     // Copy an existing set
+      ///     ICwAPI3DMultiLayerSetSnapshot* snapshot = aFactory->getMultiLayerCoverController()->getMultiLayerSetSnapshot();
+      ///     multiLayerSetID copyId = aFactory->getMultiLayerCoverController()->createMultiLayerWallWithLayers(&snapshot->sets()[0], snapshot->layers(), snapshot->textArena());
+      ///     snapshot->destroy();
+      /// @endcode
+      virtual multiLayerSetID createMultiLayerWallWithLayers(const multiLayerSet* aSet, const multiLayerLayer* aLayers, const character* aTextArena) = 0;
     };
   }
 }
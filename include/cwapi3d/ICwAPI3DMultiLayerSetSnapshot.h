@@ -0,0 +1,65 @@
+/** @file
+* Copyright (C) 2026 cadwork informatik AG
+*
+* This file is part of the CwAPI3D module for cadwork 3d.
+*
+* @ingroup       CwAPI3D
+* @since         32.0
+* @author        Paquet
+* @date          2026-10-18
+*/
+
+#pragma once
+
+#include "CwAPI3DTypes.h"
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    /**
+    * @interface ICwAPI3DMultiLayerSetSnapshot
+    * \brief Flat snapshot of multi layer sets and their layers.
+    * Layers of set i are layers()[sets()[i].mFirstLayer] to layers()[sets()[i].mFirstLayer + sets()[i].mLayerCount - 1].
+    * Names and GUIDs are zero-terminated strings in textArena(), referenced by their offset in the structs.
+    * All returned pointers stay valid until the snapshot is destroyed.
+    */
+    class ICwAPI3DMultiLayerSetSnapshot
+    {
+    public:
+      virtual ~ICwAPI3DMultiLayerSetSnapshot() noexcept = default;
+
+      /**
+       * \brief Destroys itself
+       */
+      virtual void destroy() = 0;
+
+      /**
+       * \brief Returns the number of multi layer sets
+       */
+      virtual uint32_t setCount() = 0;
+      /**
+       * \brief Returns setCount() multi layer sets
+       */
+      virtual const multiLayerSet* sets() = 0;
+
+      /**
+       * \brief Returns the total number of layers
+       */
+      virtual uint32_t layerCount() = 0;
+      /**
+       * \brief Returns layerCount() layers, grouped by set
+       */
+      virtual const multiLayerLayer* layers() = 0;
+
+      /**
+       * \brief Returns the character arena holding all names and GUIDs
+       */
+      virtual const character* textArena() = 0;
+      /**
+       * \brief Returns the size of textArena() in characters, terminators included
+       */
+      virtual uint32_t textArenaSize() = 0;
+    };
+  }
+}
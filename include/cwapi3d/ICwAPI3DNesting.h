@@ -0,0 +1,152 @@
+/** @file
+* Copyright (C) 2026 cadwork informatik AG
+*
+* This file is part of the CwAPI3D module for cadwork 3d.
+*
+* @ingroup       CwAPI3D
+* @since         32.0
+* @author        Paquet
+* @date          2026-10-18
+*/
+
+#pragma once
+
+#include "CwAPI3DTypes.h"
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    /**
+    * @interface ICwAPI3DNestingOptions
+    * \brief Input of the 2D panel nesting
+    */
+    class ICwAPI3DNestingOptions
+    {
+    public:
+      virtual ~ICwAPI3DNestingOptions() noexcept = default;
+
+      virtual void destroy() = 0;
+
+      /**
+       * \brief Sets the available raw sheet sizes
+       * \param aLengths sheet lengths
+       * \param aWidths sheet widths
+       * \param aAvailableCounts number of available sheets per size, 0 for unlimited. May be nullptr if all are unlimited.
+       * \param aCount number of sheet sizes
+       */
+      virtual void setSheetSizes(const double* aLengths, const double* aWidths, const uint32_t* aAvailableCounts, uint32_t aCount) = 0;
+      virtual uint32_t getSheetSizeCount() const = 0;
+      virtual double getSheetLength(uint32_t aIndex) const = 0;
+      virtual double getSheetWidth(uint32_t aIndex) const = 0;
+      virtual uint32_t getSheetAvailableCount(uint32_t aIndex) const = 0;
+
+      /**
+       * \brief Minimum distance between two parts
+       */
+      virtual double getPartSpacing() const = 0;
+      virtual void setPartSpacing(double aValue) = 0;
+
+      /**
+       * \brief Unused border along the sheet edges
+       */
+      virtual double getEdgeDistance() const = 0;
+      virtual void setEdgeDistance(double aValue) = 0;
+
+      /**
+       * \brief Allows parts to be rotated by 90 degrees, i.e. across the grain direction of the sheet
+       */
+      virtual bool getAllowRotation() const = 0;
+      virtual void setAllowRotation(bool aValue) = 0;
+
+      /**
+       * \brief Time the placement search may take, in milliseconds. 0 returns the first valid placement.
+       */
+      virtual uint32_t getTimeBudget() const = 0;
+      virtual void setTimeBudget(uint32_t aMilliseconds) = 0;
+
+      /**
+       * \brief Number of search threads, 0 for one per core
+       */
+      virtual uint32_t getThreadCount() const = 0;
+      virtual void setThreadCount(uint32_t aValue) = 0;
+
+      /**
+       * \brief Creates nesting parents and children in the model. Otherwise only the result data is computed.
+       */
+      virtual bool getCreateNestingElements() const = 0;
+      virtual void setCreateNestingElements(bool aValue) = 0;
+    };
+
+    /**
+    * @interface ICwAPI3DNestingResult
+    * \brief Solution of the 2D panel nesting.
+    * Parts are grouped by sheet: the parts of sheet i are [sheetPartOffsets()[i], sheetPartOffsets()[i + 1]).
+    * All returned pointers stay valid until the result is destroyed.
+    */
+    class ICwAPI3DNestingResult
+    {
+    public:
+      virtual ~ICwAPI3DNestingResult() noexcept = default;
+
+      virtual void destroy() = 0;
+
+      /**
+       * \brief Returns the number of sheets used
+       */
+      virtual uint32_t sheetCount() const = 0;
+      /**
+       * \brief Returns sheetCount() indices into the sheet sizes of the options
+       */
+      virtual const uint32_t* sheetSizeIndices() const = 0;
+      /**
+       * \brief Returns sheetCount() nesting parent IDs, 0 if no nesting elements were created
+       */
+      virtual const elementID* sheetParentIDs() const = 0;
+      /**
+       * \brief Returns sheetCount() utilisation ratios (part area / sheet area)
+       */
+      virtual const double* sheetUtilisation() const = 0;
+      /**
+       * \brief Returns sheetCount() + 1 offsets into the part arrays
+       */
+      virtual const uint32_t* sheetPartOffsets() const = 0;
+
+      /**
+       * \brief Returns the number of placed parts
+       */
+      virtual uint32_t partCount() const = 0;
+      /**
+       * \brief Returns partCount() panel element IDs, grouped by sheet
+       */
+      virtual const elementID* partElementIDs() const = 0;
+      /**
+       * \brief Returns partCount() nesting child IDs, 0 if no nesting elements were created
+       */
+      virtual const elementID* partChildIDs() const = 0;
+      /**
+       * \brief Returns partCount() placement origins in sheet coordinates (z is 0)
+       */
+      virtual const vector3D* partPositions() const = 0;
+      /**
+       * \brief Returns partCount() rotations around the sheet normal, in degrees
+       */
+      virtual const double* partRotations() const = 0;
+
+      /**
+       * \brief Returns the elements that fit on none of the sheet sizes
+       */
+      virtual uint32_t unplacedCount() const = 0;
+      virtual const elementID* unplacedElementIDs() const = 0;
+
+      /**
+       * \brief Returns the placed part area divided by the used sheet area
+       */
+      virtual double totalUtilisation() const = 0;
+      /**
+       * \brief Returns the nesting run time in milliseconds
+       */
+      virtual uint32_t elapsedTime() const = 0;
+    };
+  }
+}
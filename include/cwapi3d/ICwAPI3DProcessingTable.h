@@ -0,0 +1,100 @@
+/** @file
+* Copyright (C) 2026 cadwork informatik AG
+*
+* This file is part of the CwAPI3D module for cadwork 3d.
+*
+* @ingroup       CwAPI3D
+* @since         32.0
+* @author        Paquet
+* @date          2026-10-18
+*/
+
+#pragma once
+
+#include "CwAPI3DTypes.h"
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    /**
+    * @interface ICwAPI3DProcessingTable
+    * \brief Flat table of the machine processings of several elements, one row per processing.
+    * All returned pointers stay valid until the table is destroyed.
+    */
+    class ICwAPI3DProcessingTable
+    {
+    public:
+      virtual ~ICwAPI3DProcessingTable() noexcept = default;
+      /**
+       * \brief Destroys itself
+       */
+      virtual void destroy() = 0;
+      /**
+       * \brief Returns the number of rows in the table
+       * \return number of processings
+       */
+      virtual uint32_t count() = 0;
+      /**
+       * \brief Gets the reference element column
+       * \return pointer to count() reference element IDs
+       */
+      virtual const elementID* elementIDs() = 0;
+      /**
+       * \brief Gets the processing column
+       * \return pointer to count() processing IDs
+       */
+      virtual const elementID* processingIDs() = 0;
+      /**
+       * \brief Gets the processing code of a row
+       * \param aRow row index
+       * \return processing code, e.g. "3-010-0"
+       */
+      virtual const character* code(uint32_t aRow) = 0;
+      /**
+       * \brief Gets the processing name of a row
+       * \param aRow row index
+       * \return processing name
+       */
+      virtual const character* name(uint32_t aRow) = 0;
+      /**
+       * \brief Gets the number of reference points of a row
+       * \param aRow row index
+       * \return number of reference points
+       */
+      virtual uint32_t pointCount(uint32_t aRow) = 0;
+      /**
+       * \brief Gets the reference points of a row
+       * \param aRow row index
+       * \return pointer to pointCount(aRow) points, nullptr if there are none
+       */
+      virtual const vector3D* points(uint32_t aRow) = 0;
+      /**
+       * \brief Gets the number of numeric BTL parameters of a row
+       * \param aRow row index
+       * \return number of parameters
+       */
+      virtual uint32_t parameterCount(uint32_t aRow) = 0;
+      /**
+       * \brief Gets the BTL parameter IDs of a row, e.g. 1 for P01, in ascending order
+       * \param aRow row index
+       * \return pointer to parameterCount(aRow) parameter IDs
+       */
+      virtual const uint32_t* parameterIDs(uint32_t aRow) = 0;
+      /**
+       * \brief Gets the BTL parameter values of a row, parallel to parameterIDs()
+       * \param aRow row index
+       * \return pointer to parameterCount(aRow) values
+       */
+      virtual const double* parameterValues(uint32_t aRow) = 0;
+      /**
+       * \brief Looks up a single BTL parameter of a row
+       * \param aRow row index
+       * \param aParameterID BTL parameter ID
+       * \param aValue receives the value if the parameter exists
+       * \return true if the processing has a numeric value for the parameter, false otherwise
+       */
+      virtual bool parameterValue(uint32_t aRow, uint32_t aParameterID, double* aValue) = 0;
+    };
+  }
+}
@@ -0,0 +1,101 @@
+/** @file
+* Copyright (C) 2026 cadwork informatik AG
+*
+* This file is part of the CwAPI3D module for cadwork 3d.
+*
+* @ingroup       CwAPI3D
+* @since         32.0
+* @author        Paquet
+* @date          2026-10-18
+*/
+
+#pragma once
+
+#include "CwAPI3DTypes.h"
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    /**
+    * @interface ICwAPI3DProgressToken
+    * \brief Progress and cancellation token for long-running controller calls.
+    * The plugin creates the token, passes it to a long-running call and may poll or cancel it from another thread.
+    * The host reports nested stages through it and checks isCancelled() between work units, so a cancelled call stops
+    * at the next work unit. What happens to the work done so far depends on the call:
+    * - IFC exports (ICwAPI3DBimController::exportIfc4SilentlyWithProgress, exportIfc2x3SilentlyWithProgress): discarded, no file is written.
+    * - STEP import (ICwAPI3DFileController::importStepFileWithProgress): rolled back, no elements are imported.
+    * - Machine Data (ICwAPI3DMachineController::calculateBTLMachineDataIncremental, calculateHundeggerMachineDataIncremental):
+    *   kept, the elements already calculated are cached.
+    * - Element module (ICwAPI3DElementController::startElementModuleCalculationIncremental): kept, the covers already calculated are up to date.
+    *
+    * All functions are thread-safe.
+    */
+    class ICwAPI3DProgressToken
+    {
+    public:
+      virtual ~ICwAPI3DProgressToken() noexcept = default;
+
+      /**
+       * \brief Destroys itself
+       */
+      virtual void destroy() = 0;
+
+      /**
+       * \brief Requests cancellation
+       */
+      virtual void cancel() = 0;
+      /**
+       * \brief Checks whether cancellation was requested or the time budget is exceeded
+       * \return true if the operation should stop
+       */
+      virtual bool isCancelled() = 0;
+      /**
+       * \brief Sets a time budget, measured from the first stage begun on the token
+       * \param aMilliseconds time budget in milliseconds, 0 for none
+       */
+      virtual void setTimeBudget(uint32_t aMilliseconds) = 0;
+      /**
+       * \brief Gets the time elapsed since the first stage begun on the token
+       * \return elapsed time in milliseconds
+       */
+      virtual uint32_t elapsedTime() = 0;
+      /**
+       * \brief Clears the cancellation, the stages and the elapsed time, so the token can be reused. The time budget is kept.
+       */
+      virtual void reset() = 0;
+
+      /**
+       * \brief Gets the overall progress, all stage levels combined
+       * \return progress from 0 to 1
+       */
+      virtual double getProgress() = 0;
+      /**
+       * \brief Returns the number of currently open stages
+       */
+      virtual uint32_t getStageDepth() = 0;
+      /**
+       * \brief Gets the name of an open stage
+       * \param aLevel stage level, 0 for the outermost stage
+       * \return stage name, nullptr if aLevel >= getStageDepth(). Valid until the stage ends.
+       */
+      virtual const character* getStageName(uint32_t aLevel) = 0;
+
+      /**
+       * \brief Opens a nested stage. Called by the host.
+       * \param aName stage name, copied
+       * \param aWeight share of the parent stage covered by this stage, from 0 to 1
+       */
+      virtual void beginStage(const character* aName, double aWeight) = 0;
+      /**
+       * \brief Reports the progress of the innermost stage. Called by the host.
+       * \param aFraction progress from 0 to 1
+       */
+      virtual void setStageProgress(double aFraction) = 0;
+      /**
+       * \brief Closes the innermost stage and completes its share of the parent stage. Called by the host.
+       */
+      virtual void endStage() = 0;
+    };
+  }
+}
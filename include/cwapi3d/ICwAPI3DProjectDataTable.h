@@ -0,0 +1,68 @@
+/** @file
+* Copyright (C) 2026 cadwork informatik AG
+*
+* This file is part of the CwAPI3D module for cadwork 3d.
+*
+* @ingroup       CwAPI3D
+* @since         32.0
+* @author        Paquet
+* @date          2026-10-18
+*/
+
+#pragma once
+
+#include "CwAPI3DTypes.h"
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    /**
+    * @interface ICwAPI3DProjectDataTable
+    * \brief Project data entries read in one call.
+    * Keys are zero-terminated strings in textArena() starting at keyOffsets()[i]. Text values are likewise at valueOffsets()[i],
+    * binary values are binaryArena()[binaryOffsets()[i]] to binaryArena()[binaryOffsets()[i + 1] - 1].
+    * Text tables have no binary columns and binary tables no value column.
+    * All returned pointers stay valid until the table is destroyed.
+    */
+    class ICwAPI3DProjectDataTable
+    {
+    public:
+      virtual ~ICwAPI3DProjectDataTable() noexcept = default;
+
+      /**
+       * \brief Destroys itself
+       */
+      virtual void destroy() = 0;
+
+      /**
+       * \brief Returns the number of entries
+       */
+      virtual uint32_t count() = 0;
+      /**
+       * \brief Returns count() flags, false for keys without data
+       */
+      virtual const bool* exists() = 0;
+      /**
+       * \brief Returns the character arena holding keys and text values
+       */
+      virtual const character* textArena() = 0;
+      /**
+       * \brief Returns count() offsets of the keys in textArena()
+       */
+      virtual const uint32_t* keyOffsets() = 0;
+      /**
+       * \brief Returns count() offsets of the text values in textArena(), nullptr for binary tables
+       */
+      virtual const uint32_t* valueOffsets() = 0;
+      /**
+       * \brief Returns the byte arena holding the binary values, nullptr for text tables
+       */
+      virtual const uint8_t* binaryArena() = 0;
+      /**
+       * \brief Returns count() + 1 offsets into binaryArena(), nullptr for text tables
+       */
+      virtual const uint64_t* binaryOffsets() = 0;
+    };
+  }
+}
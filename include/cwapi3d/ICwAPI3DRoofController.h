@@ -78,6 +78,26 @@ namespace CwAPI3D
 
       /// @brief Clears all errors.
       virtual void clearErrors() = 0;
+
+      /// @brief Gets the length of every edge type and the profile length of many elements, computed in parallel.
+      /// @param[in] aElementIdList [@ref ICwAPI3DElementIDList*] The element id list.
+      /// @param[out] aEdgeLengths [double*] Receives count * @ref roofEdgeType::Count lengths, row-major:
+      /// the length of edge type t of element i is at i * roofEdgeType::Count + t, the same as getEdgeLength.
+      /// @param[out] aProfileLengths [double*] Receives count profile lengths, may be nullptr.
+      /// @param[in] aThreadCount [uint32_t] The number of threads, 0 for one per core.
+      /// @par Example:
+      /// @code{.cpp}
+      /// ICwAPI3DElementIDList* lElements = aFactory.getRoofController()->getAllCaddyElementIDs();
+      /// std::vector<double> lEdgeLengths(lElements->count() * roofEdgeType::Count);
+      /// std::vector<double> lProfileLengths(lElements->count());
+      /// aFactory.getRoofController()->getRoofLengths(lElements, lEdgeLengths.data(), lProfileLengths.data(), 0);
+      /// double lRidgeLength = 0.;
+      /// for (uint32_t i = 0; i < lElements->count(); ++i)
+      /// {
+      ///     lRidgeLength += lEdgeLengths[i * roofEdgeType::Count + roofEdgeType::Ridge];
+      /// }
+      /// @endcode
+      virtual void getRoofLengths(ICwAPI3DElementIDList* aElementIdList, double* aEdgeLengths, double* aProfileLengths, uint32_t aThreadCount) = 0;
     };
   }
 }
@@ -13,6 +13,7 @@
 #include "ICwAPI3DElementIDList.h"
 #include "ICwAPI3DString.h"
 #include "ICwAPI3DStringList.h"
+#include "ICwAPI3DVisibilityState.h"
 
 namespace CwAPI3D
 {
@@ -61,6 +62,7 @@ namespace CwAPI3D
       virtual ICwAPI3DElementIDList* getElementsFromScene(const character* aName) = 0;
 
       /// @brief Activates a scene.
+      /// @details Only elements whose visibility differs from the scene are changed.
       /// @param[in] aName [const @ref character*] The scene name.
       /// @return [bool] True if the operation succeeded, false otherwise.
       virtual bool activateScene(const character* aName) = 0;
@@ -114,6 +116,26 @@ namespace CwAPI3D
       /// @param[in] aGroupName [const @ref character*] The name of the new group.
       /// @return [uint64_t] The index of the new group.
       virtual uint64_t groupScenesWithName(ICwAPI3DStringList* aSceneNames, const character* aGroupName) = 0;
+
+      /// @brief Gets the members of a scene as a visibility state, without building an element list.
+      /// @param[in] aName [const @ref character*] The scene name.
+      /// @return [@ref ICwAPI3DVisibilityState*] The visibility the scene applies when activated, nullptr if the scene does not exist.
+      /// @par Example:
+      /// @code{.cpp}
+      /// ICwAPI3DVisibilityState* scene = aFactory.getSceneController()->getSceneVisibilityState(L"Ground floor");
+      /// ICwAPI3DElementIDList* changes = aFactory.getVisualizationController()->getVisibilityStateDifference(scene);
+      /// printf("Activating the scene changes %u elements\n", changes->count());
+      /// changes->destroy();
+      /// scene->destroy();
+      /// @endcode
+      virtual ICwAPI3DVisibilityState* getSceneVisibilityState(const character* aName) = 0;
+
+      /// @brief Gets the membership of elements in several scenes at once.
+      /// @param[in] aSceneNames [@ref ICwAPI3DStringList*] The scene names.
+      /// @param[in] aElementIdList [@ref ICwAPI3DElementIDList*] The element id list.
+      /// @param[out] aMembership [uint8_t*] Buffer of at least aElementIdList->count() * aSceneNames->count() bytes.
+      /// Receives 1 if element i is in scene j, 0 otherwise, at index i * aSceneNames->count() + j.
+      virtual void getSceneMembership(ICwAPI3DStringList* aSceneNames, ICwAPI3DElementIDList* aElementIdList, uint8_t* aMembership) = 0;
     };
   }
 }
@@ -0,0 +1,62 @@
+/** @file
+* Copyright (C) 2026 cadwork informatik AG
+*
+* This file is part of the CwAPI3D module for cadwork 3d.
+*
+* @ingroup       CwAPI3D
+* @since         32.0
+* @author        Paquet
+* @date          2026-10-18
+*/
+
+#pragma once
+
+#include "CwAPI3DTypes.h"
+#include "ICwAPI3DElementIDList.h"
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    /**
+    * @interface ICwAPI3DShopDrawingBatch
+    * \brief Queue of shop drawing exports, each written directly to a 2DC file
+    */
+    class ICwAPI3DShopDrawingBatch
+    {
+    public:
+      virtual ~ICwAPI3DShopDrawingBatch() noexcept = default;
+
+      /**
+       * \brief Destroys itself
+       */
+      virtual void destroy() = 0;
+      /**
+       * \brief Appends a job to the queue
+       * \param aType kind of export
+       * \param aElementIdList elements of the drawing, copied into the job
+       * \param aPresettingFile presetting file path, or an empty string for the current settings
+       * \param aOutputFilePath 2DC file path the drawing is written to
+       * \return job index
+       */
+      virtual uint32_t addJob(ShopDrawingExportType aType, ICwAPI3DElementIDList* aElementIdList, const character* aPresettingFile, const character* aOutputFilePath) = 0;
+      /**
+       * \brief Returns the number of jobs in the queue
+       * \return number of jobs
+       */
+      virtual uint32_t count() = 0;
+      /**
+       * \brief Queries whether a job has been written successfully
+       * \param aIndex job index
+       * \return true after the job was written, false if it failed or has not run yet
+       */
+      virtual bool succeeded(uint32_t aIndex) = 0;
+      /**
+       * \brief Gets the duration of a job
+       * \param aIndex job index
+       * \return duration in milliseconds, 0 if the job has not run yet
+       */
+      virtual double duration(uint32_t aIndex) = 0;
+    };
+  }
+}
@@ -10,7 +10,10 @@
 
 #pragma once
 
+#include "ICwAPI3DCameraData.h"
 #include "ICwAPI3DElementIDList.h"
+#include "ICwAPI3DHiddenLineSink.h"
+#include "ICwAPI3DShopDrawingBatch.h"
 #include "ICwAPI3DString.h"
 
 namespace CwAPI3D
@@ -109,6 +112,51 @@ namespace CwAPI3D
       /// @brief Loads container export settings.
       /// @param aSettingsFilePath [const @ref character*] The settings file path.
       virtual void loadExportContainerSettings(const character* aSettingsFilePath) = 0;
+
+      /// @brief Runs all jobs of a shop drawing batch and writes each drawing to its 2DC file.
+      /// @details The hidden line 2D generation of the jobs runs in parallel; no clipboard is used.
+      /// @param aBatch [@ref ICwAPI3DShopDrawingBatch*] The jobs to run. The result of each job is stored in the batch.
+      /// @return [uint32_t] The number of jobs written successfully.
+      /// @par Example:
+      /// @code{.cpp}
+      /// ICwAPI3DShopDrawingBatch* batch = aFactory.createShopDrawingBatch();
+      /// batch->addJob(ShopDrawingExportType::Wall, wall1, L"C:/presettings/wall.xml", L"C:/drawings/wall1.2dc");
+      /// batch->addJob(ShopDrawingExportType::Wall, wall2, L"C:/presettings/wall.xml", L"C:/drawings/wall2.2dc");
+      ///
+      /// uint32_t written = aFactory.getShopDrawingController()->runShopDrawingBatch(batch);
+      /// batch->destroy();
+      /// @endcode
+      virtual uint32_t runShopDrawingBatch(ICwAPI3DShopDrawingBatch* aBatch) = 0;
+
+      /// @brief Computes the hidden lines of elements for a view and streams the segments to a sink.
+      /// @details Runs headless: neither the viewport nor the visibility of the elements is changed.
+      /// The edges are partitioned across threads and culled against a spatial index over the facets.
+      /// @param aElementIdList [@ref ICwAPI3DElementIDList*] The elements to draw.
+      /// @param aCameraData [@ref ICwAPI3DCameraData*] The view direction and projection.
+      /// @param aSink [@ref ICwAPI3DHiddenLineSink*] Receives the visible and hidden segments.
+      /// @param aThreadCount [uint32_t] The number of threads, 0 for one per core.
+      /// @return [uint64_t] The number of segments delivered to the sink.
+      /// @par Example:
+      /// @code{.cpp}
+      /// class SegmentCounter : public ICwAPI3DHiddenLineSink
+      /// {
+      /// public:
+      ///   void addSegments(const vector3D*, const vector3D*, const HiddenLineSegmentType* aTypes, const elementID*, uint32_t aCount) override
+      ///   {
+      ///     for (uint32_t i = 0; i < aCount; ++i)
+      ///     {
+      ///       mVisible += aTypes[i] == HiddenLineSegmentType::Visible;
+      ///     }
+      ///   }
+      ///   uint64_t mVisible{0};
+      /// };
+      ///
+      /// SegmentCounter counter;
+      /// ICwAPI3DCameraData* camera = aFactory.getVisualizationController()->getCameraData();
+      /// aFactory.getShopDrawingController()->computeHiddenLines(elements, camera, &counter, 0);
+      /// camera->destroy();
+      /// @endcode
+      virtual uint64_t computeHiddenLines(ICwAPI3DElementIDList* aElementIdList, ICwAPI3DCameraData* aCameraData, ICwAPI3DHiddenLineSink* aSink, uint32_t aThreadCount) = 0;
     };
   }
 }
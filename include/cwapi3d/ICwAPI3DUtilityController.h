@@ -11,9 +11,11 @@
 #pragma once
 
 #include "ICwAPI3DElementIDList.h"
+#include "ICwAPI3DProjectDataTable.h"
 #include "ICwAPI3DString.h"
 #include "ICwAPI3DVertexList.h"
 #include "ICwAPI3DStringList.h"
+#include "CwAPI3DGuid.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -63,6 +65,7 @@ namespace CwAPI3D
 
       /// @brief Gets the project data.
       /// @param[in] aProjectDataId [const @ref character*] The project data id.
+      /// @note Use @ref getProjectDataBatch to read many keys.
       /// @return [@ref ICwAPI3DString*] The project data.
       virtual ICwAPI3DString* getProjectData(const character* aProjectDataId) = 0;
 
@@ -267,6 +270,7 @@ namespace CwAPI3D
       virtual void enableAutoDisplayRefresh() = 0;
 
       /// @brief Creates a new GUID.
+      /// @note Use @ref createNewGUIDs to create many GUIDs.
       /// @return [@ref ICwAPI3DString*] The new GUID.
       virtual ICwAPI3DString* createNewGUID() = 0;
 
@@ -315,6 +319,7 @@ namespace CwAPI3D
 
       /// @brief Deletes the project data.
       /// @param[in] aProjectDataId [const @ref character*] The project data id.
+      /// @note Use @ref deleteProjectDataBatch to delete many keys.
       virtual void deleteProjectData(const character* aProjectDataId) = 0;
 
       /// @brief Runs a 3D external program.
@@ -599,6 +604,89 @@ namespace CwAPI3D
       /// @brief Redirects output from Python's print function to the cadwork logger.
       /// This function is used to redirect the output of the Python interpreter to the logger. This is useful for debugging and logging purposes.
       virtual void redirectPythonOutputToLogger() = 0;
+
+      /// @brief Creates many new GUIDs in one call.
+      /// @param[in] aCount [uint32_t] The number of GUIDs to create.
+      /// @param[out] aGuids [@ref guid*] Buffer of at least aCount GUIDs.
+      /// @par Example:
+      /// @code{.cpp}
+      /// std::vector<guid> guids(1000);
+      /// aFactory.getUtilityController()->createNewGUIDs(static_cast<uint32_t>(guids.size()), guids.data());
+      ///
+      /// std::vector<character> ifcGuids(guids.size() * ifcGuidLength);
+      /// encodeIfcGuids(guids.data(), static_cast<uint32_t>(guids.size()), ifcGuids.data());
+      /// @endcode
+      virtual void createNewGUIDs(uint32_t aCount, guid* aGuids) = 0;
+
+      /// @brief Gets many project data entries in one call.
+      /// @param[in] aKeyArena [const @ref character*] Character arena holding the zero-terminated keys, nullptr for all keys.
+      /// @param[in] aKeyOffsets [const uint32_t*] aCount offsets of the keys in aKeyArena.
+      /// @param[in] aCount [uint32_t] The number of keys.
+      /// @return [@ref ICwAPI3DProjectDataTable*] The entries, in key order.
+      /// @par Example:
+      /// @code{.cpp}
+      /// const character keys[] = L"plugin.version\0plugin.state\0";
+      /// const uint32_t keyOffsets[] = {0, 15};
+      /// ICwAPI3DProjectDataTable* table = aFactory.getUtilityController()->getProjectDataBatch(keys, keyOffsets, 2);
+      /// for (uint32_t i = 0; i < table->count(); ++i)
+      /// {
+      ///     if (table->exists()[i])
+      ///     {
+      ///         wprintf(L"%ls = %ls\n", table->textArena() + table->keyOffsets()[i], table->textArena() + table->valueOffsets()[i]);
+      ///     }
+      /// }
+      /// table->destroy();
+      /// @endcode
+      virtual ICwAPI3DProjectDataTable* getProjectDataBatch(const character* aKeyArena, const uint32_t* aKeyOffsets, uint32_t aCount) = 0;
+
+      /// @brief Sets many project data entries in one call.
+      /// @param[in] aKeyArena [const @ref character*] Character arena holding the zero-terminated keys.
+      /// @param[in] aKeyOffsets [const uint32_t*] aCount offsets of the keys in aKeyArena.
+      /// @param[in] aValueArena [const @ref character*] Character arena holding the zero-terminated values.
+      /// @param[in] aValueOffsets [const uint32_t*] aCount offsets of the values in aValueArena.
+      /// @param[in] aCount [uint32_t] The number of entries.
+      virtual void setProjectDataBatch(const character* aKeyArena, const uint32_t* aKeyOffsets, const character* aValueArena, const uint32_t* aValueOffsets, uint32_t aCount) = 0;
+
+      /// @brief Deletes many project data entries, text and binary, in one call.
+      /// @param[in] aKeyArena [const @ref character*] Character arena holding the zero-terminated keys.
+      /// @param[in] aKeyOffsets [const uint32_t*] aCount offsets of the keys in aKeyArena.
+      /// @param[in] aCount [uint32_t] The number of keys.
+      /// @return [uint32_t] The number of keys that had data.
+      virtual uint32_t deleteProjectDataBatch(const character* aKeyArena, const uint32_t* aKeyOffsets, uint32_t aCount) = 0;
+
+      /// @brief Sets binary project data. Binary data is stored as is, independently of the text project data with the same key.
+      /// @param[in] aProjectDataId [const @ref character*] The project data id.
+      /// @param[in] aData [const uint8_t*] The data.
+      /// @param[in] aSize [uint64_t] The data size in bytes.
+      virtual void setProjectBinaryData(const character* aProjectDataId, const uint8_t* aData, uint64_t aSize) = 0;
+
+      /// @brief Gets binary project data.
+      /// @param[in] aProjectDataId [const @ref character*] The project data id.
+      /// @param[out] aBuffer [uint8_t*] Receives the data if it fits, may be nullptr.
+      /// @param[in] aBufferSize [uint64_t] The buffer size in bytes.
+      /// @return [uint64_t] The data size in bytes, 0 if there is no data.
+      /// @par Example:
+      /// @code{.cpp}
+      /// uint64_t size = aFactory.getUtilityController()->getProjectBinaryData(L"plugin.cache", nullptr, 0);
+      /// std::vector<uint8_t> data(size);
+      /// aFactory.getUtilityController()->getProjectBinaryData(L"plugin.cache", data.data(), size);
+      /// @endcode
+      virtual uint64_t getProjectBinaryData(const character* aProjectDataId, uint8_t* aBuffer, uint64_t aBufferSize) = 0;
+
+      /// @brief Gets many binary project data entries in one call.
+      /// @param[in] aKeyArena [const @ref character*] Character arena holding the zero-terminated keys, nullptr for all keys.
+      /// @param[in] aKeyOffsets [const uint32_t*] aCount offsets of the keys in aKeyArena.
+      /// @param[in] aCount [uint32_t] The number of keys.
+      /// @return [@ref ICwAPI3DProjectDataTable*] The entries, in key order.
+      virtual ICwAPI3DProjectDataTable* getProjectBinaryDataBatch(const character* aKeyArena, const uint32_t* aKeyOffsets, uint32_t aCount) = 0;
+
+      /// @brief Sets many binary project data entries in one call.
+      /// @param[in] aKeyArena [const @ref character*] Character arena holding the zero-terminated keys.
+      /// @param[in] aKeyOffsets [const uint32_t*] aCount offsets of the keys in aKeyArena.
+      /// @param[in] aDataArena [const uint8_t*] Byte arena holding the values.
+      /// @param[in] aDataOffsets [const uint64_t*] aCount + 1 offsets into aDataArena, value i is [aDataOffsets[i], aDataOffsets[i + 1]).
+      /// @param[in] aCount [uint32_t] The number of entries.
+      virtual void setProjectBinaryDataBatch(const character* aKeyArena, const uint32_t* aKeyOffsets, const uint8_t* aDataArena, const uint64_t* aDataOffsets, uint32_t aCount) = 0;
     };
   }
 }
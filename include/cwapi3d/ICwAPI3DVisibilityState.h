@@ -11,13 +11,15 @@
 
 #pragma once
 
+#include "ICwAPI3DElementIDList.h"
+
 namespace CwAPI3D
 {
   namespace Interfaces
   {
     /**
     * @interface ICwAPI3DVisibilityState
-    * \brief
+    * \brief Saved visibility of all elements, stored as a bitmap over the element index
     */
     class ICwAPI3DVisibilityState
     {
@@ -26,6 +28,58 @@ namespace CwAPI3D
        * \brief Destroys itself
        */
       virtual void destroy() = 0;
+      /**
+       * \brief Returns the number of visible elements
+       * \return number of visible elements
+       */
+      virtual uint32_t count() = 0;
+      /**
+       * \brief Queries whether an element is visible in this state
+       * \param aElementID element to query
+       * \return true if the element is visible, false otherwise
+       */
+      virtual bool contains(elementID aElementID) = 0;
+      /**
+       * \brief Gets the visible elements
+       * \return list of visible elements
+       */
+      virtual ICwAPI3DElementIDList* getElementIDs() = 0;
+      /**
+       * \brief Marks elements as visible
+       * \param aElementIDs elements to add
+       */
+      virtual void addElements(ICwAPI3DElementIDList* aElementIDs) = 0;
+      /**
+       * \brief Marks elements as not visible
+       * \param aElementIDs elements to remove
+       */
+      virtual void removeElements(ICwAPI3DElementIDList* aElementIDs) = 0;
+      /**
+       * \brief Adds all visible elements of another state (union)
+       * \param aOther other state
+       */
+      virtual void unite(ICwAPI3DVisibilityState* aOther) = 0;
+      /**
+       * \brief Keeps only elements that are also visible in another state (intersection)
+       * \param aOther other state
+       */
+      virtual void intersect(ICwAPI3DVisibilityState* aOther) = 0;
+      /**
+       * \brief Removes all visible elements of another state (difference)
+       * \param aOther other state
+       */
+      virtual void subtract(ICwAPI3DVisibilityState* aOther) = 0;
+      /**
+       * \brief Queries whether two states contain the same elements
+       * \param aOther other state
+       * \return true if both states are equal, false otherwise
+       */
+      virtual bool equals(ICwAPI3DVisibilityState* aOther) = 0;
+      /**
+       * \brief Creates a copy of this state
+       * \return copy, to be destroyed by the caller
+       */
+      virtual ICwAPI3DVisibilityState* clone() = 0;
     };
   }
 }
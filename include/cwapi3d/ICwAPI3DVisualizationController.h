@@ -118,6 +118,7 @@ namespace CwAPI3D
       virtual ICwAPI3DVisibilityState* saveVisibilityState() = 0;
 
       /// @brief Restores the visibility state.
+      /// @details Only elements whose visibility differs from the saved state are changed.
       /// @param aState [@ref ICwAPI3DVisibilityState*] The visibility state to restore.
       virtual void restoreVisibilityState(ICwAPI3DVisibilityState* aState) = 0;
 
@@ -126,6 +127,7 @@ namespace CwAPI3D
       virtual ICwAPI3DActivationState* saveActivationState() = 0;
 
       /// @brief Restores the activation state.
+      /// @details Only elements whose activation differs from the saved state are changed.
       /// @param aState [@ref ICwAPI3DActivationState*] The activation state to restore.
       virtual void restoreActivationState(ICwAPI3DActivationState* aState) = 0;
 
@@ -279,6 +281,53 @@ namespace CwAPI3D
       /// @brief Set the graphic option to display bitmaps as textures in shaded 2.
       /// @param aValue [bool] True to display bitmaps as textures in shaded 2, false otherwise.
       virtual void displayBitmapsAsTextureRepresentationsInShaded2(bool aValue) = 0;
+
+      /// @brief Gets the elements whose current visibility differs from a saved visibility state.
+      /// @param aState [@ref ICwAPI3DVisibilityState*] The visibility state to compare with.
+      /// @return [@ref ICwAPI3DElementIDList*] The elements that would change when restoring the state, empty if the state is current.
+      virtual ICwAPI3DElementIDList* getVisibilityStateDifference(ICwAPI3DVisibilityState* aState) = 0;
+
+      /// @brief Gets the elements whose current activation differs from a saved activation state.
+      /// @param aState [@ref ICwAPI3DActivationState*] The activation state to compare with.
+      /// @return [@ref ICwAPI3DElementIDList*] The elements that would change when restoring the state, empty if the state is current.
+      virtual ICwAPI3DElementIDList* getActivationStateDifference(ICwAPI3DActivationState* aState) = 0;
+
+      /// @brief Gets the visible, active, selectable, immutable and texture rotated state of many elements in one call.
+      /// @param aElementIdList [@ref ICwAPI3DElementIDList*] The element id list.
+      /// @param aFlags [uint8_t*] Buffer of at least aElementIdList->count() bytes, receives a combination of @ref elementStateFlag::elementStateFlag per element.
+      /// @par Example:
+      /// @code{.cpp}
+      /// ICwAPI3DElementIDList* elements = aFactory.getElementController()->getAllIdentifiableElementIDs();
+      /// std::vector<uint8_t> flags(elements->count());
+      /// aFactory.getVisualizationController()->getElementStateFlags(elements, flags.data());
+      ///
+      /// bool firstVisible = flags[0] & elementStateFlag::Visible;
+      /// @endcode
+      virtual void getElementStateFlags(ICwAPI3DElementIDList* aElementIdList, uint8_t* aFlags) = 0;
+
+      /// @brief Sets a different color on each element, with a single display invalidation.
+      /// @param aElementIdList [@ref ICwAPI3DElementIDList*] The element id list.
+      /// @param aColorIDs [const @ref colorID*] One color id per element, in list order.
+      /// @par Example:
+      /// @code{.cpp}
+      /// std::vector<colorID> colors(elements->count());
+      /// for (uint32_t i = 0; i < elements->count(); ++i)
+      /// {
+      ///     colors[i] = moistureToColor(readings[i]);
+      /// }
+      /// aFactory.getVisualizationController()->setColors(elements, colors.data());
+      /// @endcode
+      virtual void setColors(ICwAPI3DElementIDList* aElementIdList, const colorID* aColorIDs) = 0;
+
+      /// @brief Sets a different OpenGL color on each element, with a single display invalidation.
+      /// @param aElementIdList [@ref ICwAPI3DElementIDList*] The element id list.
+      /// @param aColors [const @ref colorRGB*] One color per element, in list order.
+      virtual void setOpenGLColors(ICwAPI3DElementIDList* aElementIdList, const colorRGB* aColors) = 0;
+
+      /// @brief Sets a different transparency on each element, with a single display invalidation.
+      /// @param aElementIdList [@ref ICwAPI3DElementIDList*] The element id list.
+      /// @param aValues [const int32_t*] One transparency value per element, in list order.
+      virtual void setElementTransparencies(ICwAPI3DElementIDList* aElementIdList, const int32_t* aValues) = 0;
     };
   }
 }